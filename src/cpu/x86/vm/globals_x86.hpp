@@ -131,6 +131,10 @@ define_pd_global(bool, PreserveFramePointer, false);
   product(bool, UseFastStosb, false,                                        \
           "Use fast-string operation for zeroing: rep stosb")               \
                                                                             \
+  product(intx, InitArrayShortSize, 8*BytesPerLong,                         \
+          "Compiled code clears blocks up to this size in bytes with "      \
+          "individual stores instead of rep stos")                          \
+                                                                            \
   /* Use Restricted Transactional Memory for lock eliding */                \
   product(bool, UseRTMLocking, false,                                       \
           "Enable RTM lock eliding for inflated locks in compiled code")    \
@@ -167,6 +171,11 @@ define_pd_global(bool, PreserveFramePointer, false);
   experimental(bool, UseRTMXendForLockBusy, true,                           \
           "Use RTM Xend instead of Xabort when lock busy")                  \
                                                                             \
+  experimental(intx, RTMAbortDeoptLimit, 2,                                 \
+          "Number of times a method may stop RTM lock eliding because of "  \
+          "a high abort ratio before later recompilations no longer "       \
+          "restart abort ratio profiling")                                  \
+                                                                            \
   /* assembler */                                                           \
   product(bool, Use486InstrsOnly, false,                                    \
           "Use 80486 Compliant instruction subset")                         \
@@ -6187,7 +6187,23 @@ void MacroAssembler::clear_mem(Register base, Register cnt, Register tmp) {
   assert(tmp==rax,   "tmp register must be eax for rep stos");
   assert(cnt==rcx,   "cnt register must be ecx for rep stos");
 
+  Label DONE, LOOP, LONG;
   xorptr(tmp, tmp);
+
+  // rep stos has a startup cost of tens of cycles, so clear short
+  // blocks with individual pointer-sized stores.
+  cmpptr(cnt, InitArrayShortSize/BytesPerLong);
+  jccb(Assembler::greater, LONG);
+  NOT_LP64(shlptr(cnt, 1);) // convert to number of dwords for 32-bit VM
+  decrement(cnt);
+  jccb(Assembler::negative, DONE); // zero length
+  BIND(LOOP);
+  movptr(Address(base, cnt, Address::times_ptr), tmp);
+  decrement(cnt);
+  jccb(Assembler::greaterEqual, LOOP);
+  jmpb(DONE);
+
+  BIND(LONG);
   if (UseFastStosb) {
     shlptr(cnt,3); // convert to number of bytes
     rep_stosb();
@@ -6195,6 +6211,7 @@ void MacroAssembler::clear_mem(Register base, Register cnt, Register tmp) {
     NOT_LP64(shlptr(cnt,1);) // convert to number of dwords for 32-bit VM
     rep_stos();
   }
+  BIND(DONE);
 }
 
 // IndexOf for constant substrings with size >= 8 chars
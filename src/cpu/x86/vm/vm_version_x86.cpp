@@ -925,6 +925,12 @@ void VM_Version::get_processor_features() {
     FLAG_SET_DEFAULT(UseFastStosb, false);
   }
 
+  if (InitArrayShortSize < 0 || (InitArrayShortSize % BytesPerLong) != 0) {
+    warning("InitArrayShortSize must be a non-negative multiple of %d, resetting it to %d",
+            BytesPerLong, 8 * BytesPerLong);
+    FLAG_SET_DEFAULT(InitArrayShortSize, 8 * BytesPerLong);
+  }
+
 #ifdef COMPILER2
   if (FLAG_IS_DEFAULT(AlignVector)) {
     // Modern processors allow misaligned memory operations for vectors.
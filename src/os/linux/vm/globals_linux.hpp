@@ -47,7 +47,21 @@
           "Load DLLs with executable-stack attribute in the VM Thread") \
                                                                         \
   product(bool, UseSHM, false,                                          \
-          "Use SYSV shared memory for large pages")
+          "Use SYSV shared memory for large pages")                     \
+                                                                        \
+  product(bool, UseFutexPark, false,                                    \
+          "Implement PlatformEvent and Parker with futexes instead of " \
+          "a pthread mutex and condition variable")                     \
+                                                                        \
+  product(intx, FutexParkSpinLimit, 200,                                \
+          "Maximum number of spin iterations before a futex-based park "\
+          "blocks in the kernel")                                       \
+                                                                        \
+  product(bool, UseThreadStackPool, false,                              \
+          "Reuse the stacks of exited threads for new threads")         \
+                                                                        \
+  product(uintx, ThreadStackPoolSize, 64,                               \
+          "Maximum number of unused stacks kept by UseThreadStackPool")
 
 //
 // Defines Linux-specific default values. The flags are available on all
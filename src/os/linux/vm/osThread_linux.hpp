@@ -45,8 +45,19 @@
 
   sigset_t _caller_sigmask; // Caller's signal mask
 
+  // Stack taken from the thread stack pool, see UseThreadStackPool
+  address _pooled_stack;
+  size_t  _pooled_stack_size;
+
  public:
 
+  address pooled_stack() const           { return _pooled_stack; }
+  size_t  pooled_stack_size() const      { return _pooled_stack_size; }
+  void    set_pooled_stack(address stack, size_t size) {
+    _pooled_stack = stack;
+    _pooled_stack_size = size;
+  }
+
   // Methods to save/restore caller's signal mask
   sigset_t  caller_sigmask() const       { return _caller_sigmask; }
   void    set_caller_sigmask(sigset_t sigmask)  { _caller_sigmask = sigmask; }
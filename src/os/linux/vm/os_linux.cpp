@@ -101,6 +101,7 @@
 # include <stdint.h>
 # include <inttypes.h>
 # include <sys/ioctl.h>
+# include <linux/futex.h>
 
 PRAGMA_FORMAT_MUTE_WARNINGS_FOR_GCC
 
@@ -784,6 +785,132 @@ static void *java_start(Thread *thread) {
   return 0;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// thread stack pool
+//
+// With -XX:+UseThreadStackPool, Java threads created by the VM run on stacks
+// that we map ourselves and hand to pthread_attr_setstack().  When a
+// thread exits, its stack is not unmapped but kept for the next thread of
+// the same stack size, so creating that thread neither maps nor faults in
+// fresh stack pages.
+//
+// The exiting thread still runs on its stack after free_thread(), and
+// the kernel writes to it (CLONE_CHILD_CLEARTID) when the thread ends.
+// A released stack therefore remembers the kernel thread id of its last
+// user and is only reused or unmapped once tgkill() reports that thread
+// as gone.  A recycled thread id only delays the reuse.
+
+class ThreadStackPool : AllStatic {
+  struct Entry : public CHeapObj<mtThread> {
+    address _stack;
+    size_t  _size;
+    pid_t   _last_tid;   // 0 if no thread ever ran on the stack
+    Entry*  _next;
+  };
+
+  static pthread_mutex_t _lock;
+  static Entry*          _free;   // released stacks, most recent first
+  static uintx           _count;
+
+  static bool has_exited(pid_t tid) {
+    return tid == 0 ||
+           (::syscall(SYS_tgkill, ::getpid(), tid, 0) != 0 && errno == ESRCH);
+  }
+
+  static void unmap(address stack, size_t size) {
+    ::munmap(stack, size);
+  }
+
+  // Unlinks exited stacks while the pool holds more than
+  // ThreadStackPoolSize entries.  Returns them so the caller can unmap
+  // them after dropping _lock.
+  static Entry* trim_locked() {
+    Entry* trim = NULL;
+    Entry** prev = &_free;
+    for (Entry* e = _free; e != NULL && _count > ThreadStackPoolSize; e = *prev) {
+      if (has_exited(e->_last_tid)) {
+        *prev = e->_next;
+        _count--;
+        e->_next = trim;
+        trim = e;
+        continue;
+      }
+      prev = &e->_next;
+    }
+    return trim;
+  }
+
+  static void unmap_all(Entry* trim) {
+    while (trim != NULL) {
+      Entry* next = trim->_next;
+      unmap(trim->_stack, trim->_size);
+      delete trim;
+      trim = next;
+    }
+  }
+
+ public:
+  // Returns a stack of exactly size bytes, or NULL.
+  static address allocate(size_t size) {
+    Entry* reuse = NULL;
+    pthread_mutex_lock(&_lock);
+    Entry** prev = &_free;
+    for (Entry* e = _free; e != NULL; e = *prev) {
+      if (e->_size == size && has_exited(e->_last_tid)) {
+        *prev = e->_next;
+        _count--;
+        reuse = e;
+        break;
+      }
+      prev = &e->_next;
+    }
+    Entry* trim = trim_locked();
+    pthread_mutex_unlock(&_lock);
+
+    unmap_all(trim);
+
+    if (reuse != NULL) {
+      address stack = reuse->_stack;
+      delete reuse;
+      return stack;
+    }
+    void* stack = ::mmap(NULL, size, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_STACK, -1, 0);
+    return stack == MAP_FAILED ? NULL : (address) stack;
+  }
+
+  // Called when last_tid no longer needs the stack; it may still be
+  // running on it.  Stacks of other threads that have exited since are
+  // unmapped here if the pool is over its limit, so that a burst of
+  // thread exits does not keep their pages mapped.
+  static void release(address stack, size_t size, pid_t last_tid) {
+    Entry* e = new Entry();
+    e->_stack = stack;
+    e->_size = size;
+    e->_last_tid = last_tid;
+    pthread_mutex_lock(&_lock);
+    e->_next = _free;
+    _free = e;
+    _count++;
+    Entry* trim = trim_locked();
+    pthread_mutex_unlock(&_lock);
+
+    unmap_all(trim);
+  }
+};
+
+pthread_mutex_t         ThreadStackPool::_lock  = PTHREAD_MUTEX_INITIALIZER;
+ThreadStackPool::Entry* ThreadStackPool::_free  = NULL;
+uintx                   ThreadStackPool::_count = 0;
+
+static void release_pooled_stack(OSThread* osthread) {
+  if (osthread->pooled_stack() != NULL) {
+    ThreadStackPool::release(osthread->pooled_stack(), osthread->pooled_stack_size(),
+                             osthread->thread_id());
+    osthread->set_pooled_stack(NULL, 0);
+  }
+}
+
 bool os::create_thread(Thread* thread, ThreadType thr_type, size_t stack_size) {
   assert(thread->osthread() == NULL, "caller responsible");
 
@@ -835,7 +962,22 @@ bool os::create_thread(Thread* thread, ThreadType thr_type, size_t stack_size) {
     }
 
     stack_size = MAX2(stack_size, os::Linux::min_stack_allowed);
-    pthread_attr_setstacksize(&attr, stack_size);
+    // Only Java threads: they have HotSpot's guard zones, and a stack
+    // from the pool has no glibc guard page.
+    if (UseThreadStackPool && thr_type == os::java_thread && os::Linux::is_NPTL()) {
+      stack_size = align_size_up(stack_size, os::vm_page_size());
+      address stack = ThreadStackPool::allocate(stack_size);
+      if (stack != NULL && pthread_attr_setstack(&attr, stack, stack_size) == 0) {
+        osthread->set_pooled_stack(stack, stack_size);
+      } else {
+        if (stack != NULL) {
+          ThreadStackPool::release(stack, stack_size, 0);
+        }
+        pthread_attr_setstacksize(&attr, stack_size);
+      }
+    } else {
+      pthread_attr_setstacksize(&attr, stack_size);
+    }
   } else {
     // let pthread_create() pick the default value.
   }
@@ -863,6 +1005,7 @@ bool os::create_thread(Thread* thread, ThreadType thr_type, size_t stack_size) {
       }
       // Need to clean up stuff we've allocated so far
       thread->set_osthread(NULL);
+      release_pooled_stack(osthread);
       delete osthread;
       if (lock) os::Linux::createThread_lock()->unlock();
       return false;
@@ -888,6 +1031,7 @@ bool os::create_thread(Thread* thread, ThreadType thr_type, size_t stack_size) {
   // Aborted due to thread limit being reached
   if (state == ZOMBIE) {
       thread->set_osthread(NULL);
+      release_pooled_stack(osthread);
       delete osthread;
       return false;
   }
@@ -983,6 +1127,7 @@ void os::free_thread(OSThread* osthread) {
     pthread_sigmask(SIG_SETMASK, &sigmask, NULL);
    }
 
+  release_pooled_stack(osthread);
   delete osthread;
 }
 
@@ -5562,6 +5707,75 @@ static struct timespec* compute_abstime(timespec* abstime, jlong millis) {
 }
 
 
+// Futex-based park/unpark (-XX:+UseFutexPark)
+//
+// The event or permit word itself serves as the futex.  The owner sets it
+// to -1 before blocking, and unpark() only enters the kernel when it
+// replaces a -1, so an unpark() of a thread that is not blocked is a
+// single atomic exchange.  Before blocking, park() spins briefly; the
+// spin limit doubles after a spin that saw the unpark and halves after
+// one that did not, bounded by FutexParkSpinLimit.
+
+#ifndef FUTEX_WAIT_PRIVATE
+#define FUTEX_WAIT_PRIVATE FUTEX_WAIT
+#define FUTEX_WAKE_PRIVATE FUTEX_WAKE
+#endif
+
+// Waits while *addr == val.  A negative timeout waits indefinitely.
+// Returns 0 or the errno value.
+static int futex_wait(volatile int* addr, int val, jlong timeout_nanos) {
+  struct timespec ts;
+  struct timespec* tsp = NULL;
+  if (timeout_nanos >= 0) {
+    ts.tv_sec  = timeout_nanos / NANOSECS_PER_SEC;
+    ts.tv_nsec = timeout_nanos % NANOSECS_PER_SEC;
+    tsp = &ts;
+  }
+  int ret = syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, tsp, NULL, 0);
+  return ret == 0 ? 0 : errno;
+}
+
+static void futex_wake(volatile int* addr) {
+  syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+static bool futex_spin(volatile int* addr, int& spin_limit) {
+  if (spin_limit <= 0 || os::processor_count() == 1) {
+    return false;
+  }
+  for (int i = 0; i < spin_limit; i++) {
+    if (*addr != -1) {
+      spin_limit = MIN2(spin_limit * 2, (int) FutexParkSpinLimit);
+      return true;
+    }
+    SpinPause();
+  }
+  spin_limit = MAX2(spin_limit / 2, MIN2(16, (int) FutexParkSpinLimit));
+  return false;
+}
+
+// Blocks while *addr == -1.  Returns false if the timeout expired first.
+static bool futex_park(volatile int* addr, int& spin_limit, jlong timeout_nanos) {
+  if (futex_spin(addr, spin_limit)) {
+    return true;
+  }
+  jlong deadline = timeout_nanos >= 0 ? os::javaTimeNanos() + timeout_nanos : 0;
+  while (*addr == -1) {
+    jlong remaining = -1;
+    if (timeout_nanos >= 0) {
+      remaining = deadline - os::javaTimeNanos();
+      if (remaining <= 0) {
+        return false;
+      }
+    }
+    int status = futex_wait(addr, -1, remaining);
+    assert_status(status == 0 || status == EINTR || status == EAGAIN ||
+                  status == ETIMEDOUT, status, "futex_wait");
+  }
+  return true;
+}
+
+
 // Test-and-clear _Event, always leaves _Event set to 0, returns immediately.
 // Conceptually TryPark() should be equivalent to park(0).
 
@@ -5583,7 +5797,11 @@ void os::PlatformEvent::park() {       // AKA "down()"
       if (Atomic::cmpxchg (v-1, &_Event, v) == v) break ;
   }
   guarantee (v >= 0, "invariant") ;
-  if (v == 0) {
+  if (v == 0 && UseFutexPark) {
+    futex_park(&_Event, _spin_limit, -1);
+    _Event = 0 ;
+    OrderAccess::fence();
+  } else if (v == 0) {
      // Do this the hard way by blocking ...
      int status = pthread_mutex_lock(_mutex);
      assert_status(status == 0, status, "mutex_lock");
@@ -5619,6 +5837,19 @@ int os::PlatformEvent::park(jlong millis) {
   guarantee (v >= 0, "invariant") ;
   if (v != 0) return OS_OK ;
 
+  if (UseFutexPark) {
+    // Same cap as compute_abstime()
+    jlong timeout = MIN2(MAX2(millis, (jlong) 0), (jlong) 50000000 * 1000);
+    if (!futex_park(&_Event, _spin_limit, timeout * NANOSECS_PER_MILLISEC) &&
+        Atomic::cmpxchg(0, &_Event, -1) == -1) {
+      return OS_TIMEOUT;
+    }
+    // Either woken, or an unpark() raced with the timeout.
+    _Event = 0 ;
+    OrderAccess::fence();
+    return OS_OK;
+  }
+
   // We do this the hard way, by blocking the thread.
   // Consider enforcing a minimum timeout value.
   struct timespec abst;
@@ -5690,6 +5921,11 @@ void os::PlatformEvent::unpark() {
 
   if (Atomic::xchg(1, &_Event) >= 0) return;
 
+  if (UseFutexPark) {
+    futex_wake(&_Event);
+    return;
+  }
+
   // Wait for the thread associated with the event to vacate
   int status = pthread_mutex_lock(_mutex);
   assert_status(status == 0, status, "mutex_lock");
@@ -5830,6 +6066,42 @@ void Parker::park(bool isAbsolute, jlong time) {
   if (time < 0 || (isAbsolute && time == 0) ) { // don't wait at all
     return;
   }
+  if (UseFutexPark) {
+    // _counter is 1 when a permit is available and -1 while we are
+    // blocked in futex_park().
+    // Timeouts are capped at MAX_SECS like in unpackTime(), which also
+    // keeps the conversion of far-future deadlines from overflowing.
+    jlong timeout_nanos = -1;
+    if (isAbsolute) {
+      jlong millis = MIN2(MAX2(time - os::javaTimeMillis(), (jlong) 0),
+                          (jlong) MAX_SECS * MILLIUNITS);
+      timeout_nanos = millis * NANOSECS_PER_MILLISEC;
+    } else if (time > 0) {
+      timeout_nanos = MIN2(time, (jlong) MAX_SECS * NANOSECS_PER_SEC);
+    }
+
+    // See the comments below about deadlocks.
+    ThreadBlockInVM tbivm(jt);
+
+    if (Thread::is_interrupted(thread, false)) {
+      return;
+    }
+    // Fails if a permit arrived since the fast-path check above.
+    if (Atomic::cmpxchg(-1, &_counter, 0) == 0) {
+      OSThreadWaitState osts(thread->osthread(), false /* not Object.wait() */);
+      jt->set_suspend_equivalent();
+      // cleared by handle_special_suspend_equivalent_condition() or java_suspend_self()
+      futex_park(&_counter, _spin_limit, timeout_nanos);
+    }
+    // Consume the permit, or clear the -1 left by a timeout.
+    Atomic::xchg(0, &_counter);
+
+    // If externally suspended while waiting, re-suspend
+    if (jt->handle_special_suspend_equivalent_condition()) {
+      jt->java_suspend_self();
+    }
+    return;
+  }
   if (time > 0) {
     unpackTime(&absTime, isAbsolute, time);
   }
@@ -5907,6 +6179,13 @@ void Parker::park(bool isAbsolute, jlong time) {
 }
 
 void Parker::unpark() {
+  if (UseFutexPark) {
+    if (Atomic::xchg(1, &_counter) < 0) {
+      futex_wake(&_counter);
+    }
+    return;
+  }
+
   int s, status ;
   status = pthread_mutex_lock(_mutex);
   assert (status == 0, "invariant") ;
@@ -295,6 +295,7 @@ class PlatformEvent : public CHeapObj<mtInternal> {
     double CachePad [4] ;   // increase odds that _mutex is sole occupant of cache line
     volatile int _Event ;
     volatile int _nParked ;
+    int _spin_limit ;       // adaptive spin limit for UseFutexPark
     pthread_mutex_t _mutex  [1] ;
     pthread_cond_t  _cond   [1] ;
     double PostPad  [2] ;
@@ -312,6 +313,7 @@ class PlatformEvent : public CHeapObj<mtInternal> {
       assert_status(status == 0, status, "mutex_init");
       _Event   = 0 ;
       _nParked = 0 ;
+      _spin_limit = FutexParkSpinLimit ;
       _Assoc   = NULL ;
     }
 
@@ -332,6 +334,7 @@ class PlatformParker : public CHeapObj<mtInternal> {
         ABS_INDEX = 1
     };
     int _cur_index;  // which cond is in use: -1, 0, 1
+    int _spin_limit; // adaptive spin limit for UseFutexPark
     pthread_mutex_t _mutex [1] ;
     pthread_cond_t  _cond  [2] ; // one for relative times and one for abs.
 
@@ -348,6 +351,7 @@ class PlatformParker : public CHeapObj<mtInternal> {
       status = pthread_mutex_init (_mutex, NULL);
       assert_status(status == 0, status, "mutex_init");
       _cur_index = -1; // mark as unused
+      _spin_limit = FutexParkSpinLimit;
     }
 };
 
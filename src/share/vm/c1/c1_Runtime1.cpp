@@ -53,6 +53,7 @@
 #include "runtime/javaCalls.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/threadCritical.hpp"
+#include "runtime/timer.hpp"
 #include "runtime/vframe.hpp"
 #include "runtime/vframeArray.hpp"
 #include "utilities/copy.hpp"
@@ -231,6 +232,7 @@ void Runtime1::generate_blob_for(BufferBlob* buffer_blob, StubID id) {
 
 
 void Runtime1::initialize(BufferBlob* blob) {
+  TraceTime timer("C1 runtime stubs generation", TraceStartupTime);
   // platform-dependent initialization
   initialize_pd();
   // generate stubs
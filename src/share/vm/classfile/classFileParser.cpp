@@ -4856,21 +4856,18 @@ void ClassFileParser::verify_legal_method_modifiers(
 void ClassFileParser::verify_legal_utf8(const unsigned char* buffer, int length, TRAPS) {
   assert(_need_verify, "only called when _need_verify is true");
   int i = 0;
-  int count = length >> 2;
+  // Skip the leading ASCII characters a machine word at a time.
+  // For a word w, (w | w - 0x01..01) & 0x80..80 is zero iff every byte
+  // v of w is in 0 < v < 128: a byte >= 128 has its highest bit set,
+  // and the first zero byte borrows and so sets its highest bit.
+  const uintptr_t low_bits  = ~(uintptr_t)0 / 0xFF;
+  const uintptr_t high_bits = low_bits << 7;
+  int count = length / (int) sizeof(uintptr_t);
   for (int k=0; k<count; k++) {
-    unsigned char b0 = buffer[i];
-    unsigned char b1 = buffer[i+1];
-    unsigned char b2 = buffer[i+2];
-    unsigned char b3 = buffer[i+3];
-    // For an unsigned char v,
-    // (v | v - 1) is < 128 (highest bit 0) for 0 < v < 128;
-    // (v | v - 1) is >= 128 (highest bit 1) for v == 0 or v >= 128.
-    unsigned char res = b0 | b0 - 1 |
-                        b1 | b1 - 1 |
-                        b2 | b2 - 1 |
-                        b3 | b3 - 1;
-    if (res >= 128) break;
-    i += 4;
+    uintptr_t w;
+    memcpy(&w, buffer + i, sizeof(uintptr_t));
+    if (((w | (w - low_bits)) & high_bits) != 0) break;
+    i += sizeof(uintptr_t);
   }
   for(; i < length; i++) {
     unsigned short c;
@@ -50,6 +50,7 @@
 #include "oops/symbol.hpp"
 #include "prims/jvm_misc.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/compilationPolicy.hpp"
 #include "runtime/fprofiler.hpp"
 #include "runtime/handles.hpp"
@@ -58,6 +59,7 @@
 #include "runtime/interfaceSupport.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
+#include "runtime/orderAccess.inline.hpp"
 #include "runtime/threadCritical.hpp"
 #include "runtime/timer.hpp"
 #include "services/management.hpp"
@@ -90,6 +92,7 @@ typedef jzentry* (JNICALL *FindEntry_t)(jzfile *zip, const char *name, jint *siz
 typedef jboolean (JNICALL *ReadEntry_t)(jzfile *zip, jzentry *entry, unsigned char *buf, char *namebuf);
 typedef jboolean (JNICALL *ReadMappedEntry_t)(jzfile *zip, jzentry *entry, unsigned char **buf, char *namebuf);
 typedef jzentry* (JNICALL *GetNextEntry_t)(jzfile *zip, jint n);
+typedef void     (JNICALL *FreeEntry_t)(jzfile *zip, jzentry *entry);
 typedef jint     (JNICALL *Crc32_t)(jint crc, const jbyte *buf, jint len);
 
 static ZipOpen_t         ZipOpen            = NULL;
@@ -98,6 +101,7 @@ static FindEntry_t       FindEntry          = NULL;
 static ReadEntry_t       ReadEntry          = NULL;
 static ReadMappedEntry_t ReadMappedEntry    = NULL;
 static GetNextEntry_t    GetNextEntry       = NULL;
+static FreeEntry_t       FreeEntry          = NULL;
 static canonicalize_fn_t CanonicalizeEntry  = NULL;
 static Crc32_t           Crc32              = NULL;
 
@@ -256,6 +260,8 @@ ClassPathZipEntry::ClassPathZipEntry(jzfile* zip, const char* zip_name) : ClassP
   char *copy = NEW_C_HEAP_ARRAY(char, strlen(zip_name)+1, mtClass);
   strcpy(copy, zip_name);
   _zip_name = copy;
+  _package_index = NULL;
+  _misses = 0;
 }
 
 ClassPathZipEntry::~ClassPathZipEntry() {
@@ -263,16 +269,98 @@ ClassPathZipEntry::~ClassPathZipEntry() {
     (*ZipClose)(_zip);
   }
   FREE_C_HEAP_ARRAY(char, _zip_name, mtClass);
+  if (_package_index != NULL) {
+    FREE_C_HEAP_ARRAY(juint, _package_index, mtClass);
+  }
+}
+
+juint ClassPathZipEntry::package_hash(const char* name, int len) {
+  juint h = 0;
+  for (int i = 0; i < len; i++) {
+    h = 31 * h + (juint) (unsigned char) name[i];
+  }
+  return h;
+}
+
+int ClassPathZipEntry::compare_hashes(const void* h1, const void* h2) {
+  juint a = *(const juint*) h1;
+  juint b = *(const juint*) h2;
+  return (a < b) ? -1 : ((a > b) ? 1 : 0);
+}
+
+// Returns false only if no entry of the archive lives in the directory of
+// name.  Hash collisions merely cause an unnecessary native lookup.
+bool ClassPathZipEntry::may_contain(const char* name) {
+  juint* index = (juint*) OrderAccess::load_ptr_acquire(&_package_index);
+  if (index == NULL) {
+    return true;
+  }
+  const char* last_slash = strrchr(name, '/');
+  int len = (last_slash == NULL) ? 0 : (int) (last_slash - name);
+  juint h = package_hash(name, len);
+  return bsearch(&h, index + 1, index[0], sizeof(juint), compare_hashes) != NULL;
+}
+
+// Record the hashes of every directory that contains an entry, including
+// all enclosing directories (the zip library also matches "a/b" against
+// a directory entry "a/b/").  Called in native state.
+void ClassPathZipEntry::build_package_index() {
+  if (FreeEntry == NULL) {
+    return;
+  }
+  int capacity = 256;
+  int length = 0;
+  juint* index = NEW_C_HEAP_ARRAY(juint, capacity + 1, mtClass);
+  for (int n = 0; ; n++) {
+    jzentry* ze = (*GetNextEntry)(_zip, n);
+    if (ze == NULL) break;
+    const char* last_slash = strrchr(ze->name, '/');
+    int len = (last_slash == NULL) ? 0 : (int) (last_slash - ze->name);
+    while (true) {
+      if (length == capacity) {
+        capacity *= 2;
+        index = REALLOC_C_HEAP_ARRAY(juint, index, capacity + 1, mtClass);
+      }
+      index[1 + length++] = package_hash(ze->name, len);
+      if (len == 0) break;
+      // Continue with the enclosing directory
+      while (len > 0 && ze->name[len - 1] != '/') {
+        len--;
+      }
+      if (len > 0) len--;
+    }
+    (*FreeEntry)(_zip, ze);
+  }
+  qsort(index + 1, length, sizeof(juint), compare_hashes);
+  int unique = 0;
+  for (int i = 0; i < length; i++) {
+    if (unique == 0 || index[unique] != index[1 + i]) {
+      index[1 + unique++] = index[1 + i];
+    }
+  }
+  index[0] = (juint) unique;
+  if (Atomic::cmpxchg_ptr(index, &_package_index, NULL) != NULL) {
+    // Another thread built the index concurrently
+    FREE_C_HEAP_ARRAY(juint, index, mtClass);
+  }
 }
 
 u1* ClassPathZipEntry::open_entry(const char* name, jint* filesize, bool nul_terminate, TRAPS) {
+  if (!may_contain(name)) {
+    return NULL;
+  }
     // enable call to C land
   JavaThread* thread = JavaThread::current();
   ThreadToNativeFromVM ttn(thread);
   // check whether zip archive contains name
   jint name_len;
   jzentry* entry = (*FindEntry)(_zip, name, filesize, &name_len);
-  if (entry == NULL) return NULL;
+  if (entry == NULL) {
+    if (_package_index == NULL && ++_misses == package_index_threshold) {
+      build_package_index();
+    }
+    return NULL;
+  }
   u1* buffer;
   char name_buf[128];
   char* filename;
@@ -818,9 +906,11 @@ void ClassLoader::load_zip_library() {
   ReadEntry    = CAST_TO_FN_PTR(ReadEntry_t, os::dll_lookup(handle, "ZIP_ReadEntry"));
   ReadMappedEntry = CAST_TO_FN_PTR(ReadMappedEntry_t, os::dll_lookup(handle, "ZIP_ReadMappedEntry"));
   GetNextEntry = CAST_TO_FN_PTR(GetNextEntry_t, os::dll_lookup(handle, "ZIP_GetNextEntry"));
+  FreeEntry    = CAST_TO_FN_PTR(FreeEntry_t, os::dll_lookup(handle, "ZIP_FreeEntry"));
   Crc32        = CAST_TO_FN_PTR(Crc32_t, os::dll_lookup(handle, "ZIP_CRC32"));
 
   // ZIP_Close is not exported on Windows in JDK5.0 so don't abort if ZIP_Close is NULL
+  // ZIP_FreeEntry is optional; without it zip entries are not indexed
   if (ZipOpen == NULL || FindEntry == NULL || ReadEntry == NULL ||
       GetNextEntry == NULL || Crc32 == NULL) {
     vm_exit_during_initialization("Corrupted ZIP library", path);
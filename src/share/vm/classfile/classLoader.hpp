@@ -102,6 +102,17 @@ class ClassPathZipEntry: public ClassPathEntry {
  private:
   jzfile* _zip;              // The zip archive
   const char*   _zip_name;   // Name of zip archive
+  // Sorted hashes of all directories in the archive, prefixed by their
+  // number.  Built once the archive has missed package_index_threshold
+  // lookups, so that lookups of names in other packages can skip the
+  // native zip lookup.  NULL while not (yet) available.
+  juint* volatile _package_index;
+  int _misses;
+  enum { package_index_threshold = 16 };
+  static juint package_hash(const char* name, int len);
+  static int compare_hashes(const void* h1, const void* h2);
+  bool may_contain(const char* name);
+  void build_package_index();
  public:
   bool is_jar_file()  { return true;  }
   const char* name()  { return _zip_name; }
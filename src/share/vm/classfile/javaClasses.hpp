@@ -179,6 +179,14 @@ class java_lang_String : AllStatic {
   // For this reason, THIS ALGORITHM MUST MATCH String.hashCode().
   template <typename T> static unsigned int hash_code(T* s, int len) {
     unsigned int h = 0;
+    // Four characters per step: h*31^4 + s0*31^3 + s1*31^2 + s2*31 + s3
+    // equals the sequential form, but shortens the multiply dependency chain.
+    while (len >= 4) {
+      h = 923521*h + 29791*(unsigned int) s[0] + 961*(unsigned int) s[1] +
+          31*(unsigned int) s[2] + (unsigned int) s[3];
+      s += 4;
+      len -= 4;
+    }
     while (len-- > 0) {
       h = 31*h + (unsigned int) *s;
       s++;
@@ -128,7 +128,10 @@ private:
   static void buckets_unlink(int start_idx, int end_idx, int* processed, int* removed, size_t* memory_total);
 public:
   enum {
-    symbol_alloc_batch_size = 8,
+    // Number of new constant pool symbols added under one acquisition of
+    // SymbolTable_lock.  Large generated classes create thousands of new
+    // symbols, so keep the number of lock round trips per class low.
+    symbol_alloc_batch_size = 32,
     // Pick initial size based on java -version size measurements
     symbol_alloc_arena_size = 360*K
   };
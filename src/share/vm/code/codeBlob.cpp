@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "code/codeBlob.hpp"
 #include "code/codeCache.hpp"
+#include "code/perfMap.hpp"
 #include "code/relocInfo.hpp"
 #include "compiler/disassembler.hpp"
 #include "interpreter/bytecode.hpp"
@@ -168,6 +169,7 @@ void CodeBlob::trace_new_stub(CodeBlob* stub, const char* name1, const char* nam
       tty->cr();
     }
     Forte::register_stub(stub_id, stub->code_begin(), stub->code_end());
+    PerfMap::register_stub(stub_id, stub->code_begin(), stub->code_end());
 
     if (JvmtiExport::should_post_dynamic_code_generated()) {
       const char* stub_name = name2;
@@ -27,6 +27,7 @@
 #include "code/compiledIC.hpp"
 #include "code/dependencies.hpp"
 #include "code/nmethod.hpp"
+#include "code/perfMap.hpp"
 #include "code/scopeDesc.hpp"
 #include "compiler/abstractCompiler.hpp"
 #include "compiler/compileBroker.hpp"
@@ -535,6 +536,7 @@ nmethod* nmethod::new_native_nmethod(methodHandle method,
 
   if (nm != NULL) {
     nm->log_new_nmethod();
+    PerfMap::register_nmethod(nm);
   }
 
   return nm;
@@ -571,6 +573,7 @@ nmethod* nmethod::new_dtrace_nmethod(methodHandle method,
 
   if (nm != NULL) {
     nm->log_new_nmethod();
+    PerfMap::register_nmethod(nm);
   }
 
   return nm;
@@ -644,6 +647,7 @@ nmethod* nmethod::new_nmethod(methodHandle method,
     // Safepoints in nmethod::verify aren't allowed because nm hasn't been installed yet.
     DEBUG_ONLY(nm->verify();)
     nm->log_new_nmethod();
+    PerfMap::register_nmethod(nm);
   }
   return nm;
 }
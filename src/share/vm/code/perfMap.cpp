@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "code/nmethod.hpp"
+#include "code/perfMap.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/globals_extension.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/task.hpp"
+
+class PerfMapFlushTask : public PeriodicTask {
+ public:
+  PerfMapFlushTask(int interval_time) : PeriodicTask(interval_time) {}
+  void task() { PerfMap::flush(); }
+};
+
+int               PerfMap::_fd     = -1;
+char*             PerfMap::_buffer = NULL;
+size_t            PerfMap::_pos    = 0;
+PerfMapFlushTask* PerfMap::_task   = NULL;
+
+void perfMap_init() {
+  PerfMap::initialize();
+}
+
+void PerfMap::initialize() {
+  if (!UsePerfMap) {
+    return;
+  }
+  char path[64];
+  jio_snprintf(path, sizeof(path), "/tmp/perf-%d.map", os::current_process_id());
+  _fd = os::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (_fd < 0) {
+    warning("Could not create perf map file %s; disabling UsePerfMap", path);
+    FLAG_SET_DEFAULT(UsePerfMap, false);
+    return;
+  }
+  _buffer = NEW_C_HEAP_ARRAY(char, buffer_size, mtInternal);
+  _task = new PerfMapFlushTask(flush_interval);
+  _task->enroll();
+}
+
+// Called from before_exit() after the WatcherThread has been stopped.
+// Code installed after this point is no longer recorded.
+void PerfMap::destroy() {
+  if (!UsePerfMap) {
+    return;
+  }
+  _task->disenroll();
+  delete _task;
+  _task = NULL;
+
+  MutexLockerEx ml(PerfMap_lock, Mutex::_no_safepoint_check_flag);
+  flush_locked();
+  os::close(_fd);
+  _fd = -1;
+}
+
+void PerfMap::write(address start, address end, const char* name) {
+  char line[512];
+  int len = jio_snprintf(line, sizeof(line), PTR_FORMAT " " SIZE_FORMAT_HEX " %s\n",
+                         start, pointer_delta(end, start, 1), name);
+  if (len < 0 || len >= (int) sizeof(line)) {
+    // Truncated; keep the address range and as much of the name as fits.
+    len = (int) sizeof(line) - 1;
+    line[len - 1] = '\n';
+  }
+
+  MutexLockerEx ml(PerfMap_lock, Mutex::_no_safepoint_check_flag);
+  if (_fd < 0) {
+    return;
+  }
+  if (_pos + len > buffer_size) {
+    flush_locked();
+  }
+  memcpy(_buffer + _pos, line, len);
+  _pos += len;
+}
+
+void PerfMap::flush_locked() {
+  assert_lock_strong(PerfMap_lock);
+  if (_pos > 0 && _fd >= 0) {
+    os::write(_fd, _buffer, (unsigned int) _pos);
+  }
+  _pos = 0;
+}
+
+void PerfMap::flush() {
+  MutexLockerEx ml(PerfMap_lock, Mutex::_no_safepoint_check_flag);
+  flush_locked();
+}
+
+void PerfMap::register_nmethod(nmethod* nm) {
+  if (!UsePerfMap) {
+    return;
+  }
+  ResourceMark rm;
+  const char* kind = nm->is_native_method()   ? "native"
+                   : nm->is_compiled_by_c1()  ? "c1"
+                   : nm->is_compiled_by_c2()  ? "c2"
+                   : "compiled";
+  char name[512];
+  jio_snprintf(name, sizeof(name), "%s [%s%s]",
+               nm->method()->name_and_sig_as_C_string(),
+               kind, nm->is_osr_method() ? " osr" : "");
+  write(nm->code_begin(), nm->code_end(), name);
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_CODE_PERFMAP_HPP
+#define SHARE_VM_CODE_PERFMAP_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/globals.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class nmethod;
+class PerfMapFlushTask;
+
+// PerfMap writes the address range and name of every piece of generated
+// code to /tmp/perf-<pid>.map (-XX:+UsePerfMap), which is the file Linux
+// perf consults to symbolize frames in anonymous executable memory.
+//
+// Entries are formatted by the thread that installs the code and appended
+// to an in-memory buffer; the buffer is written to the file by a periodic
+// task on the WatcherThread, when it fills up, and at VM exit.
+
+class PerfMap : AllStatic {
+  friend class PerfMapFlushTask;
+ private:
+  enum { buffer_size = 64 * K,
+         flush_interval = 1000 };    // milliseconds
+
+  static int               _fd;
+  static char*             _buffer;
+  static size_t            _pos;
+  static PerfMapFlushTask* _task;
+
+  static void write(address start, address end, const char* name);
+  static void flush_locked();
+  static void flush();
+
+ public:
+  static void initialize();
+  static void destroy();
+
+  static void register_stub(const char* name, address start, address end) {
+    if (UsePerfMap) {
+      write(start, end, name);
+    }
+  }
+  static void register_nmethod(nmethod* nm);
+};
+
+#endif // SHARE_VM_CODE_PERFMAP_HPP
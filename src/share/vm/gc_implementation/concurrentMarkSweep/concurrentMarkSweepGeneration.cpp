@@ -3887,8 +3887,10 @@ class CMSConcMarkingTerminator: public ParallelTaskTerminator {
   // "queue_set" is a set of work queues of other threads.
   // "collector" is the CMS collector associated with this task terminator.
   // "yield" indicates whether we need the gang as a whole to yield.
+  // Every offering thread must reach yield() for the gang to yield, so
+  // this terminator never blocks threads.
   CMSConcMarkingTerminator(int n_threads, TaskQueueSetSuper* queue_set, CMSCollector* collector) :
-    ParallelTaskTerminator(n_threads, queue_set),
+    ParallelTaskTerminator(n_threads, queue_set, false /* may_block */),
     _collector(collector) { }
 
   void set_task(CMSConcMarkingTask* task) {
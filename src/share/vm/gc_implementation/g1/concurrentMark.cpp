@@ -146,8 +146,10 @@ class ClearBitmapHRClosure : public HeapRegionClosure {
   ConcurrentMark* _cm;
   CMBitMap* _bitmap;
   bool _may_yield;      // The closure may yield during iteration. If yielded, abort the iteration.
+  uint _worker_id;
  public:
-  ClearBitmapHRClosure(ConcurrentMark* cm, CMBitMap* bitmap, bool may_yield) : HeapRegionClosure(), _cm(cm), _bitmap(bitmap), _may_yield(may_yield) {
+  ClearBitmapHRClosure(ConcurrentMark* cm, CMBitMap* bitmap, bool may_yield, uint worker_id = 0) :
+    HeapRegionClosure(), _cm(cm), _bitmap(bitmap), _may_yield(may_yield), _worker_id(worker_id) {
     assert(!may_yield || cm != NULL, "CM must be non-NULL if this closure is expected to yield.");
   }
 
@@ -159,12 +161,16 @@ class ClearBitmapHRClosure : public HeapRegionClosure {
 
     while (cur < end) {
       MemRegion mr(cur, MIN2(cur + chunk_size_in_words, end));
-      _bitmap->clearRange(mr);
+      // Most chunks of a large heap carry no marks at all; reading the
+      // bitmap is much cheaper than writing it back.
+      if (_bitmap->getNextMarkedWordAddress(mr.start(), mr.end()) < mr.end()) {
+        _bitmap->clearRange(mr);
+      }
 
       cur += chunk_size_in_words;
 
       // Abort iteration if after yielding the marking has been aborted.
-      if (_may_yield && _cm->do_yield_check() && _cm->has_aborted()) {
+      if (_may_yield && _cm->do_yield_check(_worker_id) && _cm->has_aborted()) {
         return true;
       }
       // Repeat the asserts from before the start of the closure. We will do them
@@ -549,7 +555,7 @@ ConcurrentMark::ConcurrentMark(G1CollectedHeap* g1h, G1RegionToSpaceMapper* prev
   // _active_tasks set in set_non_marking_state
   // _tasks set inside the constructor
   _task_queues(new CMTaskQueueSet((int) _max_worker_id)),
-  _terminator(ParallelTaskTerminator((int) _max_worker_id, _task_queues)),
+  _terminator((int) _max_worker_id, _task_queues),
 
   _has_overflown(false),
   _concurrent(false),
@@ -856,6 +862,41 @@ ConcurrentMark::~ConcurrentMark() {
   ShouldNotReachHere();
 }
 
+// Clears the next mark bitmap on the concurrent marking workers.  Workers
+// claim regions by index; the claim does not touch the regions' claim
+// values, which evacuation pauses that happen while the workers yield
+// expect to be untouched.
+class CMClearNextBitmapTask : public AbstractGangTask {
+  ConcurrentMark* _cm;
+  CMBitMap*       _bitmap;
+  volatile jint   _next_region;
+
+public:
+  void work(uint worker_id) {
+    SuspendibleThreadSetJoiner sts;
+    G1CollectedHeap* g1h = G1CollectedHeap::heap();
+    ClearBitmapHRClosure cl(_cm, _bitmap, true /* may_yield */, worker_id);
+    const uint max_regions = g1h->max_regions();
+    while (!_cm->has_aborted()) {
+      uint index = (uint) (Atomic::add(1, &_next_region) - 1);
+      if (index >= max_regions) {
+        break;
+      }
+      // Regions committed later get a cleared bitmap when they are
+      // committed.
+      if (!g1h->is_region_available(index)) {
+        continue;
+      }
+      if (cl.doHeapRegion(g1h->region_at(index))) {
+        break;
+      }
+    }
+  }
+
+  CMClearNextBitmapTask(ConcurrentMark* cm, CMBitMap* bitmap) :
+    AbstractGangTask("Clear Next Bitmap"), _cm(cm), _bitmap(bitmap), _next_region(0) { }
+};
+
 void ConcurrentMark::clearNextBitmap() {
   G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
@@ -869,13 +910,23 @@ void ConcurrentMark::clearNextBitmap() {
   // is the case.
   guarantee(!g1h->mark_in_progress(), "invariant");
 
-  ClearBitmapHRClosure cl(this, _nextMarkBitMap, true /* may_yield */);
-  g1h->heap_region_iterate(&cl);
+  // The workers join the suspendible thread set themselves, so this
+  // thread must not be a member while it waits for them.
+  CMClearNextBitmapTask task(this, _nextMarkBitMap);
+  if (use_parallel_marking_threads()) {
+    _parallel_workers->set_active_workers((int) MAX2(1U, parallel_marking_threads()));
+    _parallel_workers->run_task(&task);
+  } else {
+    task.work(0);
+  }
 
-  // Clear the liveness counting data. If the marking has been aborted, the abort()
-  // call already did that.
-  if (cl.complete()) {
-    clear_all_count_data();
+  {
+    SuspendibleThreadSetJoiner sts;
+    // Clear the liveness counting data. If the marking has been aborted, the abort()
+    // call already did that.
+    if (!has_aborted()) {
+      clear_all_count_data();
+    }
   }
 
   // Repeat the asserts from above.
@@ -3515,15 +3566,50 @@ inline void CMTask::process_grey_object(oop obj) {
   }
 
   size_t obj_size = obj->size();
-  _words_scanned += obj_size;
-
-  if (scan) {
-    obj->oop_iterate(_cm_oop_closure);
+  if (scan && obj->is_objArray() && obj_size >= 2 * ObjArrayMarkingStride) {
+    _words_scanned += scan_obj_array_slice(objArrayOop(obj), (HeapWord*) obj);
+  } else {
+    _words_scanned += obj_size;
+    if (scan) {
+      obj->oop_iterate(_cm_oop_closure);
+    }
   }
   statsOnly( ++_objs_scanned );
   check_limits();
 }
 
+size_t CMTask::scan_obj_array_slice(objArrayOop obj, HeapWord* start) {
+  HeapWord* end = (HeapWord*) obj + obj->size();
+  assert((HeapWord*) obj <= start && start < end, "slice outside of array");
+  size_t words = MIN2(pointer_delta(end, start), (size_t) ObjArrayMarkingStride);
+  HeapWord* next = start + words;
+  // Push the rest first, so that other tasks can steal it while we scan.
+  if (next < end) {
+    push(encode_array_slice(next));
+  }
+  obj->oop_iterate(_cm_oop_closure, MemRegion(start, next));
+  return words;
+}
+
+void CMTask::process_array_slice(oop slice) {
+  HeapWord* addr = decode_array_slice(slice);
+  // Slices only refer to marked arrays below NTAMS of old or humongous
+  // regions, where the block offset table finds the array start.
+  HeapRegion* hr = _g1h->heap_region_containing_raw(addr);
+  HeapWord* start = hr->isHumongous() ? hr->humongous_start_region()->bottom()
+                                      : hr->block_start(addr);
+  assert(oop(start)->is_objArray(), "slice must be part of an object array");
+  assert(_nextMarkBitMap->isMarked(start), "array of a slice must be marked");
+
+  if (_cm->verbose_high()) {
+    gclog_or_tty->print_cr("[%u] processing array slice " PTR_FORMAT " of " PTR_FORMAT,
+                           _worker_id, p2i(addr), p2i(start));
+  }
+
+  _words_scanned += scan_obj_array_slice(objArrayOop(start), addr);
+  check_limits();
+}
+
 template void CMTask::process_grey_object<true>(oop);
 template void CMTask::process_grey_object<false>(oop);
 
@@ -3914,6 +4000,9 @@ void CMTask::drain_local_queue(bool partially) {
                              _worker_id, target_size);
     }
 
+    // Popped objects are prefetched and scanned a few pops later, when
+    // their headers are more likely to be in the cache.
+    TaskPrefetchWindow<oop, 4> window;
     oop obj;
     bool ret = _task_queue->pop_local(obj);
     while (ret) {
@@ -3928,7 +4017,11 @@ void CMTask::drain_local_queue(bool partially) {
       assert(!_g1h->is_on_master_free_list(
                   _g1h->heap_region_containing((HeapWord*) obj)), "invariant");
 
-      scan_object(obj);
+      Prefetch::read(obj->mark_addr(), 0);
+      window.push(obj);
+      if (window.is_full()) {
+        scan_object(window.pop());
+      }
 
       if (_task_queue->size() <= target_size || has_aborted()) {
         ret = false;
@@ -3936,6 +4029,10 @@ void CMTask::drain_local_queue(bool partially) {
         ret = _task_queue->pop_local(obj);
       }
     }
+    // The window must be empty before anyone can steal or terminate.
+    while (!window.is_empty()) {
+      scan_object(window.pop());
+    }
 
     if (_cm->verbose_high()) {
       gclog_or_tty->print_cr("[%u] drained local queue, size = %d",
@@ -4428,7 +4525,7 @@ void CMTask::do_marking_step(double time_target_ms,
 
         statsOnly( ++_steals );
 
-        assert(_nextMarkBitMap->isMarked((HeapWord*) obj),
+        assert(is_array_slice(obj) || _nextMarkBitMap->isMarked((HeapWord*) obj),
                "any stolen object should be marked");
         scan_object(obj);
 
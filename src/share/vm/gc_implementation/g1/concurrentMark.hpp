@@ -1109,6 +1109,32 @@ private:
 
   template<bool scan> void process_grey_object(oop obj);
 
+  // Large object arrays are scanned ObjArrayMarkingStride words at a
+  // time.  The unscanned rest of such an array is pushed on the queues
+  // as an array slice: the address of the first word still to scan,
+  // tagged so that it cannot be mistaken for an object.
+  static const uintptr_t ArraySliceTag = 1;
+
+  static bool is_array_slice(oop entry) {
+    return ((uintptr_t) (void*) entry & ArraySliceTag) != 0;
+  }
+  static oop encode_array_slice(HeapWord* addr) {
+    assert(((uintptr_t) addr & ArraySliceTag) == 0, "misaligned slice");
+    return cast_to_oop((uintptr_t) addr | ArraySliceTag);
+  }
+  static HeapWord* decode_array_slice(oop entry) {
+    assert(is_array_slice(entry), "not an array slice");
+    return (HeapWord*) ((uintptr_t) (void*) entry & ~ArraySliceTag);
+  }
+
+  // Scans the words of obj from start on, at most ObjArrayMarkingStride
+  // of them, after pushing the rest as a new slice.  Returns the number
+  // of words scanned.
+  size_t scan_obj_array_slice(objArrayOop obj, HeapWord* start);
+
+  // Scans the next part of the array an entry from the queues refers to.
+  void process_array_slice(oop slice);
+
 public:
   // It resets the task; it should be called right at the beginning of
   // a marking phase.
@@ -1170,8 +1196,15 @@ public:
   // Precondition: obj is a valid heap object.
   inline void deal_with_reference(oop obj);
 
-  // It scans an object and visits its children.
-  void scan_object(oop obj) { process_grey_object<true>(obj); }
+  // It scans an object and visits its children.  obj may also be an
+  // array slice taken from the queues.
+  void scan_object(oop obj) {
+    if (is_array_slice(obj)) {
+      process_array_slice(obj);
+    } else {
+      process_grey_object<true>(obj);
+    }
+  }
 
   // It pushes an object on the local queue.
   inline void push(oop obj);
@@ -227,8 +227,8 @@ inline void CMTask::push(oop obj) {
   assert(_g1h->is_in_g1_reserved(objAddr), "invariant");
   assert(!_g1h->is_on_master_free_list(
               _g1h->heap_region_containing((HeapWord*) objAddr)), "invariant");
-  assert(!_g1h->is_obj_ill(obj), "invariant");
-  assert(_nextMarkBitMap->isMarked(objAddr), "invariant");
+  assert(is_array_slice(obj) || !_g1h->is_obj_ill(obj), "invariant");
+  assert(is_array_slice(obj) || _nextMarkBitMap->isMarked(objAddr), "invariant");
 
   if (_cm->verbose_high()) {
     gclog_or_tty->print_cr("[%u] pushing " PTR_FORMAT, _worker_id, p2i((void*) obj));
@@ -803,6 +803,19 @@ HeapWord* G1CollectedHeap::humongous_obj_allocate(size_t word_size, AllocationCo
       _hrm.allocate_free_regions_starting_at(first, obj_regions);
     } else {
       // Policy: Potentially trigger a defragmentation GC.
+      // Report when the request failed only because the free space is
+      // fragmented, so that users can size G1HeapRegionSize to keep
+      // their large arrays out of multi-region humongous allocation.
+      uint free_regions = _hrm.num_free_regions() + _hrm.available();
+      if (free_regions >= obj_regions) {
+        ergo_verbose3(ErgoHeapSizing,
+                      "humongous allocation request failed",
+                      ergo_format_reason("no contiguous free regions")
+                      ergo_format_byte("allocation request")
+                      ergo_format_region("required")
+                      ergo_format_region("free"),
+                      word_size * HeapWordSize, obj_regions, free_regions);
+      }
     }
   }
 
@@ -5741,6 +5754,10 @@ void G1CollectedHeap::evacuate_collection_set(EvacuationInfo& evacuation_info) {
       AdaptiveSizePolicy::calc_active_workers(workers()->total_workers(),
                                      workers()->active_workers(),
                                      Threads::number_of_non_daemon_threads());
+    if (UseDynamicNumberOfGCThreads) {
+      // Do not wake more workers than the recent pauses could keep busy.
+      n_workers = g1_policy()->parallel_workers_limit(n_workers);
+    }
     assert(UseDynamicNumberOfGCThreads ||
            n_workers == workers()->total_workers(),
            "If not dynamic should be using all the  workers");
@@ -5751,6 +5768,7 @@ void G1CollectedHeap::evacuate_collection_set(EvacuationInfo& evacuation_info) {
            "Should be the original non-parallel value");
     n_workers = 1;
   }
+  g1_policy()->record_pause_workers(n_workers);
 
 
   init_for_evac_failure(NULL);
@@ -1298,6 +1298,9 @@ public:
   // Return the region with the given index. It assumes the index is valid.
   inline HeapRegion* region_at(uint index) const;
 
+  // Return whether the region with the given index is committed.
+  bool is_region_available(uint index) const { return _hrm.is_available(index); }
+
   // Calculate the region index of the given address. Given address must be
   // within the heap.
   inline uint addr_to_region(HeapWord* addr) const;
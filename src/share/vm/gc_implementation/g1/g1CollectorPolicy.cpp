@@ -111,6 +111,8 @@ G1CollectorPolicy::G1CollectorPolicy() :
   _rs_lengths_seq(new TruncatedSeq(TruncatedSeqLength)),
 
   _pause_time_target_ms((double) MaxGCPauseMillis),
+  _parallel_workers_limit(0),
+  _pause_workers(0),
 
   _gcs_are_young(true),
 
@@ -1188,9 +1190,64 @@ void G1CollectorPolicy::record_collection_pause_end(double pause_time_ms, Evacua
   adjust_concurrent_refinement(phase_times()->average_time_ms(G1GCPhaseTimes::UpdateRS),
                                phase_times()->sum_thread_work_items(G1GCPhaseTimes::UpdateRS), update_rs_time_goal_ms);
 
+  if (update_stats) {
+    update_parallel_workers_limit();
+  }
+
   _collectionSetChooser->verify();
 }
 
+void G1CollectorPolicy::record_pause_workers(uint n_workers) {
+  _pause_workers = n_workers;
+  phase_times()->note_evacuation_workers(n_workers);
+}
+
+void G1CollectorPolicy::update_parallel_workers_limit() {
+  if (!UseDynamicNumberOfGCThreads || !G1CollectedHeap::use_parallel_gc_threads()) {
+    return;
+  }
+  // Only the first _pause_workers slots of the per-worker data were
+  // written during this pause; the rest hold stale or uninitialized times.
+  // GCWorkerTotal is not filled in until note_gc_end(), so derive each
+  // worker's time from its start and end stamps.
+  uint active_workers = _pause_workers;
+  uint total_workers = _g1->workers()->total_workers();
+  if (active_workers < 2) {
+    return;
+  }
+  double worker_total_ms = 0.0;
+  double termination_ms = 0.0;
+  for (uint i = 0; i < active_workers; i++) {
+    worker_total_ms += phase_times()->get_time_ms(G1GCPhaseTimes::GCWorkerEnd, i) -
+                       phase_times()->get_time_ms(G1GCPhaseTimes::GCWorkerStart, i);
+    termination_ms += phase_times()->get_time_ms(G1GCPhaseTimes::Termination, i);
+  }
+  if (worker_total_ms < MIN_TIMER_GRANULARITY) {
+    return;
+  }
+  double termination_ratio = termination_ms / worker_total_ms;
+
+  // Workers that spend a large part of the pause offering termination
+  // had too little work to share; keep only as many as the useful work
+  // needs.  If termination is negligible, allow more workers again.
+  const double high_termination_ratio = 0.2;
+  const double low_termination_ratio = 0.05;
+  uint limit = (_parallel_workers_limit == 0) ? total_workers : _parallel_workers_limit;
+  if (termination_ratio > high_termination_ratio) {
+    uint busy_workers = (uint) ceil(active_workers * (1.0 - termination_ratio));
+    limit = MAX2(busy_workers, 2U);
+  } else if (termination_ratio < low_termination_ratio && active_workers >= limit) {
+    limit = MIN2(limit * 2, total_workers);
+  }
+  _parallel_workers_limit = limit;
+
+  if (TraceDynamicGCThreads) {
+    gclog_or_tty->print_cr("G1CollectorPolicy::update_parallel_workers_limit() : "
+                           "active_workers: %u  termination_ratio: %1.2f  limit: %u",
+                           active_workers, termination_ratio, limit);
+  }
+}
+
 #define EXT_SIZE_FORMAT "%.1f%s"
 #define EXT_SIZE_PARAMS(bytes)                                  \
   byte_size_in_proper_unit((double)(bytes)),                    \
@@ -296,6 +296,17 @@ private:
 
   size_t _pending_cards;
 
+  // Number of parallel workers the last pauses could keep busy, derived
+  // from how much of the parallel phase the workers spent in
+  // termination.  Zero if there is no estimate yet.
+  uint _parallel_workers_limit;
+
+  // Number of workers that actually took part in the current evacuation
+  // pause, after the cap above was applied.
+  uint _pause_workers;
+
+  void update_parallel_workers_limit();
+
 public:
   // Accessors
 
@@ -315,6 +326,18 @@ public:
   bool verify_young_ages();
 #endif // PRODUCT
 
+  // Caps the number of active workers for the next evacuation pause
+  // with the estimate from update_parallel_workers_limit().
+  uint parallel_workers_limit(uint n_workers) const {
+    if (_parallel_workers_limit == 0) {
+      return n_workers;
+    }
+    return MIN2(n_workers, _parallel_workers_limit);
+  }
+
+  // Records the number of workers the evacuation pause actually uses.
+  void record_pause_workers(uint n_workers);
+
   double get_new_prediction(TruncatedSeq* seq) {
     return MAX2(seq->davg() + sigma() * seq->dsd(),
                 seq->davg() * confidence_factor(seq->num()));
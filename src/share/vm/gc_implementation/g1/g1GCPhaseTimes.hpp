@@ -123,6 +123,8 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
  public:
   G1GCPhaseTimes(uint max_gc_threads);
   void note_gc_start(uint active_gc_threads, bool mark_in_progress);
+  // The evacuation may use fewer workers than were active at note_gc_start().
+  void note_evacuation_workers(uint active_gc_threads);
   void note_gc_end();
   void print(double pause_time_sec);
 
@@ -31,9 +31,11 @@
 #include "gc_implementation/parallelScavenge/psCompactionManager.hpp"
 #include "gc_implementation/parallelScavenge/psOldGen.hpp"
 #include "gc_implementation/parallelScavenge/psParallelCompact.hpp"
+#include "gc_implementation/shared/gcTrace.hpp"
 #include "oops/objArrayKlass.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/oop.pcgc.inline.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "utilities/stack.inline.hpp"
 
 PSOldGen*            ParCompactionManager::_old_gen = NULL;
@@ -56,6 +58,9 @@ ParCompactionManager::ParCompactionManager() :
     _action(CopyAndUpdate),
     _region_stack(NULL),
     _region_stack_index((uint)max_uintx) {
+#if INCLUDE_SERVICES
+  _live_klasses = NULL;
+#endif
 
   ParallelScavengeHeap* heap = (ParallelScavengeHeap*)Universe::heap();
   assert(heap->kind() == CollectedHeap::ParallelScavengeHeap, "Sanity");
@@ -121,6 +126,51 @@ void ParCompactionManager::initialize(ParMarkBitMap* mbm) {
     "Not initialized?");
 }
 
+#if INCLUDE_SERVICES
+void ParCompactionManager::start_live_object_counting() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  uint parallel_gc_threads = PSParallelCompact::gc_task_manager()->workers();
+  for (uint i = 0; i < parallel_gc_threads + 1; i++) {
+    ParCompactionManager* cm = manager_array(i);
+    assert(cm->_live_klasses == NULL, "counting already started");
+    KlassInfoTable* cit = new KlassInfoTable(false);
+    if (cit->allocation_failed()) {
+      // Partial counts are useless; let the caller walk the heap.
+      delete cit;
+      for (uint j = 0; j < i; j++) {
+        delete manager_array(j)->_live_klasses;
+        manager_array(j)->_live_klasses = NULL;
+      }
+      return;
+    }
+    cm->_live_klasses = cit;
+  }
+}
+
+bool ParCompactionManager::report_live_object_count(GCTracer* tracer) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  uint parallel_gc_threads = PSParallelCompact::gc_task_manager()->workers();
+  if (manager_array(0)->_live_klasses == NULL) {
+    return false;
+  }
+  // Merge into the table of the VM thread's manager.
+  KlassInfoTable* result = manager_array(parallel_gc_threads)->_live_klasses;
+  bool success = true;
+  for (uint i = 0; i < parallel_gc_threads; i++) {
+    ParCompactionManager* cm = manager_array(i);
+    success &= result->merge(cm->_live_klasses);
+    delete cm->_live_klasses;
+    cm->_live_klasses = NULL;
+  }
+  if (success) {
+    tracer->report_live_object_count_after_gc(result);
+  }
+  delete result;
+  manager_array(parallel_gc_threads)->_live_klasses = NULL;
+  return success;
+}
+#endif // INCLUDE_SERVICES
+
 int ParCompactionManager::pop_recycled_stack_index() {
   assert(_recycled_bottom <= _recycled_top, "list is empty");
   // Get the next available index
@@ -181,8 +231,18 @@ void ParCompactionManager::follow_marking_stacks() {
     while (marking_stack()->pop_overflow(obj)) {
       obj->follow_contents(this);
     }
+    // Prefetch each object as it is popped and follow it a few pops
+    // later, when its header is more likely to be in the cache.
+    TaskPrefetchWindow<oop, 4> window;
     while (marking_stack()->pop_local(obj)) {
-      obj->follow_contents(this);
+      Prefetch::read(obj->mark_addr(), 0);
+      window.push(obj);
+      if (window.is_full()) {
+        window.pop()->follow_contents(this);
+      }
+    }
+    while (!window.is_empty()) {
+      window.pop()->follow_contents(this);
     }
 
     // Process ObjArrays one at a time to avoid marking stack bloat.
@@ -26,8 +26,12 @@
 #define SHARE_VM_GC_IMPLEMENTATION_PARALLELSCAVENGE_PSCOMPACTIONMANAGER_HPP
 
 #include "memory/allocation.hpp"
+#include "utilities/macros.hpp"
 #include "utilities/stack.hpp"
 #include "utilities/taskqueue.hpp"
+#if INCLUDE_SERVICES
+#include "memory/heapInspection.hpp"
+#endif
 
 // Move to some global location
 #define HAS_BEEN_MOVED 0x1501d01d
@@ -37,6 +41,8 @@
 class MutableSpace;
 class PSOldGen;
 class ParCompactionManager;
+class GCTracer;
+class KlassInfoTable;
 class ObjectStartArray;
 class ParallelCompactData;
 class ParMarkBitMap;
@@ -114,6 +120,12 @@ private:
 
   Action _action;
 
+#if INCLUDE_SERVICES
+  // Per-class counts of the objects this manager marked, gathered only
+  // when the object count after GC is reported.
+  KlassInfoTable* _live_klasses;
+#endif
+
   static PSOldGen* old_gen()             { return _old_gen; }
   static ObjectStartArray* start_array() { return _start_array; }
   static OopTaskQueueSet* stack_array()  { return _stack_array; }
@@ -196,6 +208,14 @@ private:
   // Process tasks remaining on any stack
   void drain_region_stacks();
 
+  // Count the live objects per class while marking, so that the object
+  // count after GC can be reported without walking the heap again.
+  inline void record_live_object(oop obj);
+  static void start_live_object_counting() NOT_SERVICES_RETURN;
+  // Merge the per-manager counts and report them.  Returns false if no
+  // counts were gathered; the caller must then walk the heap instead.
+  static bool report_live_object_count(GCTracer* tracer) NOT_SERVICES_RETURN_(false);
+
 };
 
 inline ParCompactionManager* ParCompactionManager::manager_array(int index) {
@@ -209,4 +229,13 @@ bool ParCompactionManager::marking_stacks_empty() const {
   return _marking_stack.is_empty() && _objarray_stack.is_empty();
 }
 
+inline void ParCompactionManager::record_live_object(oop obj) {
+#if INCLUDE_SERVICES
+  if (_live_klasses != NULL) {
+    // A failure to allocate an entry only undercounts, as in a heap walk.
+    _live_klasses->record_instance(obj);
+  }
+#endif
+}
+
 #endif // SHARE_VM_GC_IMPLEMENTATION_PARALLELSCAVENGE_PSCOMPACTIONMANAGER_HPP
@@ -2364,6 +2364,12 @@ void PSParallelCompact::marking_phase(ParCompactionManager* cm,
   // Need new claim bits before marking starts.
   ClassLoaderDataGraph::clear_claimed_marks();
 
+  // Gather the object count after GC while marking instead of walking
+  // the heap afterwards.
+  if (_gc_tracer.should_report_object_count()) {
+    ParCompactionManager::start_live_object_counting();
+  }
+
   {
     GCTraceTime tm_m("par mark", print_phases(), true, &_gc_timer, _gc_tracer.gc_id());
 
@@ -2430,7 +2436,9 @@ void PSParallelCompact::marking_phase(ParCompactionManager* cm,
 
   // Clean up unreferenced symbols in symbol table.
   SymbolTable::unlink();
-  _gc_tracer.report_object_count_after_gc(is_alive_closure());
+  if (!ParCompactionManager::report_live_object_count(&_gc_tracer)) {
+    _gc_tracer.report_object_count_after_gc(is_alive_closure());
+  }
 }
 
 void PSParallelCompact::follow_class_loader(ParCompactionManager* cm,
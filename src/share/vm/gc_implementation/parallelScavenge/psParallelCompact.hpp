@@ -1349,6 +1349,7 @@ inline void PSParallelCompact::follow_root(ParCompactionManager* cm, T* p) {
     oop obj = oopDesc::decode_heap_oop_not_null(heap_oop);
     if (mark_bitmap()->is_unmarked(obj)) {
       if (mark_obj(obj)) {
+        cm->record_live_object(obj);
         obj->follow_contents(cm);
       }
     }
@@ -1362,6 +1363,7 @@ inline void PSParallelCompact::mark_and_push(ParCompactionManager* cm, T* p) {
   if (!oopDesc::is_null(heap_oop)) {
     oop obj = oopDesc::decode_heap_oop_not_null(heap_oop);
     if (mark_bitmap()->is_unmarked(obj) && mark_obj(obj)) {
+      cm->record_live_object(obj);
       cm->push(obj);
     }
   }
@@ -128,11 +128,24 @@ void GCTracer::report_object_count_after_gc(BoolObjectClosure* is_alive_cl) {
     if (!cit.allocation_failed()) {
       HeapInspection hi(false, false, false, NULL);
       hi.populate_table(&cit, is_alive_cl);
-      ObjectCountEventSenderClosure event_sender(_shared_gc_info.gc_id(), cit.size_of_instances_in_words(), Ticks::now());
-      cit.iterate(&event_sender);
+      report_live_object_count_after_gc(&cit);
     }
   }
 }
+
+void GCTracer::report_live_object_count_after_gc(KlassInfoTable* live_klasses) {
+  assert_set_gc_id();
+  assert(live_klasses != NULL, "Must supply the live object counts");
+
+  if (ObjectCountEventSender::should_send_event()) {
+    ObjectCountEventSenderClosure event_sender(_shared_gc_info.gc_id(), live_klasses->size_of_instances_in_words(), Ticks::now());
+    live_klasses->iterate(&event_sender);
+  }
+}
+
+bool GCTracer::should_report_object_count() const {
+  return ObjectCountEventSender::should_send_event();
+}
 #endif // INCLUDE_SERVICES
 
 void GCTracer::report_gc_heap_summary(GCWhen::Type when, const GCHeapSummary& heap_summary) const {
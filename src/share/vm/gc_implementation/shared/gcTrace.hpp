@@ -48,6 +48,7 @@ class PSHeapSummary;
 class ReferenceProcessorStats;
 class TimePartitions;
 class BoolObjectClosure;
+class KlassInfoTable;
 
 class SharedGCInfo VALUE_OBJ_CLASS_SPEC {
  private:
@@ -127,6 +128,9 @@ class GCTracer : public ResourceObj {
   void report_metaspace_summary(GCWhen::Type when, const MetaspaceSummary& metaspace_summary) const;
   void report_gc_reference_stats(const ReferenceProcessorStats& rp) const;
   void report_object_count_after_gc(BoolObjectClosure* object_filter) NOT_SERVICES_RETURN;
+  // Report per-class live counts that the collector gathered while marking.
+  void report_live_object_count_after_gc(KlassInfoTable* live_klasses) NOT_SERVICES_RETURN;
+  bool should_report_object_count() const NOT_SERVICES_RETURN_(false);
   bool has_reported_gc_start() const;
   const GCId& gc_id() { return _shared_gc_info.gc_id(); }
 
@@ -320,6 +320,14 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   inline static oop array_allocate(KlassHandle klass, int size, int length, TRAPS);
   inline static oop array_allocate_nozero(KlassHandle klass, int size, int length, TRAPS);
 
+  // Allocates count arrays of the same klass and length next to each
+  // other in the current thread's TLAB, with one TLAB bump and one bulk
+  // clear.  Returns the first array, the others follow at size word
+  // intervals.  Returns NULL, allocating nothing, if the batch does not
+  // fit in the TLAB; the caller then allocates the arrays one by one.
+  inline static HeapWord* array_allocate_batch(KlassHandle klass, int size, int length,
+                                               int count, TRAPS);
+
   inline static void post_allocation_install_obj_klass(KlassHandle klass,
                                                        oop obj);
 
@@ -219,6 +219,37 @@ oop CollectedHeap::array_allocate(KlassHandle klass,
   return (oop)obj;
 }
 
+HeapWord* CollectedHeap::array_allocate_batch(KlassHandle klass,
+                                              int size,
+                                              int length,
+                                              int count,
+                                              TRAPS) {
+  debug_only(check_for_valid_allocation_state());
+  assert(!Universe::heap()->is_gc_active(), "Allocation during gc not allowed");
+  assert(size > 0 && count > 0, "sanity");
+  CHECK_UNHANDLED_OOPS_ONLY(THREAD->clear_unhandled_oops();)
+
+  if (!UseTLAB || HAS_PENDING_EXCEPTION) {
+    return NULL;
+  }
+  // Check before multiplying: size * count can overflow size_t on 32-bit.
+  if ((size_t) count > THREAD->tlab().free() / (size_t) size) {
+    return NULL;
+  }
+  size_t total = (size_t) size * (size_t) count;
+  HeapWord* start = THREAD->tlab().allocate(total);
+  if (start == NULL) {
+    return NULL;
+  }
+  Copy::zero_to_words(start, total);
+  for (int i = 0; i < count; i++) {
+    HeapWord* obj = start + (size_t) i * size;
+    post_allocation_setup_array(klass, obj, length);
+    NOT_PRODUCT(Universe::heap()->check_for_bad_heap_word_value(obj, size));
+  }
+  return start;
+}
+
 oop CollectedHeap::array_allocate_nozero(KlassHandle klass,
                                          int size,
                                          int length,
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "asm/macroAssembler.hpp"
 #include "asm/macroAssembler.inline.hpp"
+#include "code/perfMap.hpp"
 #include "compiler/disassembler.hpp"
 #include "interpreter/bytecodeHistogram.hpp"
 #include "interpreter/bytecodeInterpreter.hpp"
@@ -126,6 +127,11 @@ void interpreter_init() {
     AbstractInterpreter::code()->code_start(),
     AbstractInterpreter::code()->code_end()
   );
+  PerfMap::register_stub(
+    "Interpreter",
+    AbstractInterpreter::code()->code_start(),
+    AbstractInterpreter::code()->code_end()
+  );
 
   // notify JVMTI profiler
   if (JvmtiExport::should_post_dynamic_code_generated()) {
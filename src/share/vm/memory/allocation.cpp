@@ -32,7 +32,9 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/threadCritical.hpp"
+#include "runtime/threadLocalStorage.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/ostream.hpp"
 
@@ -230,13 +232,24 @@ void trace_heap_free(void* p) {
 //--------------------------------------------------------------------------------------
 // ChunkPool implementation
 
+// Returns the current thread if it keeps a ChunkCache, NULL otherwise.
+static Thread* chunk_cache_thread() {
+  if (!ThreadLocalStorage::is_initialized()) {
+    return NULL;
+  }
+  Thread* thread = ThreadLocalStorage::thread();
+  return (thread != NULL && thread->uses_chunk_cache()) ? thread : NULL;
+}
+
 // MT-safe pool of chunks to reduce malloc/free thrashing
 // NB: not using Mutex because pools are used before Threads are initialized
 class ChunkPool: public CHeapObj<mtInternal> {
   Chunk*       _first;        // first cached Chunk; its first word points to next chunk
   size_t       _num_chunks;   // number of unused chunks in pool
   size_t       _num_used;     // number of chunks currently checked out
+                              // (including those in thread ChunkCaches)
   const size_t _size;         // size of each chunk (must be uniform)
+  const int    _cache_index;  // index of this pool in a ChunkCache
 
   // Our four static pools
   static ChunkPool* _large_pool;
@@ -256,11 +269,20 @@ class ChunkPool: public CHeapObj<mtInternal> {
 
  public:
   // All chunks in a ChunkPool has the same size
-   ChunkPool(size_t size) : _size(size) { _first = NULL; _num_chunks = _num_used = 0; }
+   ChunkPool(size_t size, int cache_index) : _size(size), _cache_index(cache_index) {
+     _first = NULL; _num_chunks = _num_used = 0;
+   }
 
   // Allocate a new chunk from the pool (might expand the pool)
   _NOINLINE_ void* allocate(size_t bytes, AllocFailType alloc_failmode) {
     assert(bytes == _size, "bad size");
+    Thread* thread = chunk_cache_thread();
+    if (thread != NULL) {
+      Chunk* c = thread->chunk_cache()->take(_cache_index);
+      if (c != NULL) {
+        return c;
+      }
+    }
     void* p = NULL;
     // No VM lock can be taken inside ThreadCritical lock, so os::malloc
     // should be done outside ThreadCritical lock due to NMT
@@ -278,6 +300,15 @@ class ChunkPool: public CHeapObj<mtInternal> {
   // Return a chunk to the pool
   void free(Chunk* chunk) {
     assert(chunk->length() + Chunk::aligned_overhead_size() == _size, "bad size");
+    Thread* thread = chunk_cache_thread();
+    if (thread != NULL && thread->chunk_cache()->put(_cache_index, chunk)) {
+      return;
+    }
+    release(chunk);
+  }
+
+  // Return a chunk to the global list
+  void release(Chunk* chunk) {
     ThreadCritical tc;
     _num_used--;
 
@@ -324,11 +355,21 @@ class ChunkPool: public CHeapObj<mtInternal> {
   static ChunkPool* small_pool()  { assert(_small_pool  != NULL, "must be initialized"); return _small_pool;  }
   static ChunkPool* tiny_pool()   { assert(_tiny_pool   != NULL, "must be initialized"); return _tiny_pool;   }
 
+  static ChunkPool* pool_at(int cache_index) {
+    switch (cache_index) {
+      case 0: return large_pool();
+      case 1: return medium_pool();
+      case 2: return small_pool();
+      case 3: return tiny_pool();
+      default: ShouldNotReachHere(); return NULL;
+    }
+  }
+
   static void initialize() {
-    _large_pool  = new ChunkPool(Chunk::size        + Chunk::aligned_overhead_size());
-    _medium_pool = new ChunkPool(Chunk::medium_size + Chunk::aligned_overhead_size());
-    _small_pool  = new ChunkPool(Chunk::init_size   + Chunk::aligned_overhead_size());
-    _tiny_pool   = new ChunkPool(Chunk::tiny_size   + Chunk::aligned_overhead_size());
+    _large_pool  = new ChunkPool(Chunk::size        + Chunk::aligned_overhead_size(), 0);
+    _medium_pool = new ChunkPool(Chunk::medium_size + Chunk::aligned_overhead_size(), 1);
+    _small_pool  = new ChunkPool(Chunk::init_size   + Chunk::aligned_overhead_size(), 2);
+    _tiny_pool   = new ChunkPool(Chunk::tiny_size   + Chunk::aligned_overhead_size(), 3);
   }
 
   static void clean() {
@@ -349,6 +390,15 @@ void chunkpool_init() {
   ChunkPool::initialize();
 }
 
+void ChunkCache::flush() {
+  for (int i = 0; i < num_pools; i++) {
+    Chunk* c = take(i);
+    if (c != NULL) {
+      ChunkPool::pool_at(i)->release(c);
+    }
+  }
+}
+
 void
 Chunk::clean_chunk_pool() {
   ChunkPool::clean();
@@ -362,6 +362,42 @@ class Chunk: CHeapObj<mtChunk> {
   static void clean_chunk_pool();
 };
 
+//------------------------------ChunkCache-------------------------------------
+// Free pooled chunks kept by one thread, at most one per pool size, so
+// that threads which keep creating and releasing arenas do not take the
+// ThreadCritical lock guarding the global chunk pools every time.
+class ChunkCache VALUE_OBJ_CLASS_SPEC {
+ public:
+  enum { num_pools = 4 };
+
+ private:
+  Chunk* _chunks[num_pools];
+
+ public:
+  ChunkCache() {
+    for (int i = 0; i < num_pools; i++) {
+      _chunks[i] = NULL;
+    }
+  }
+
+  Chunk* take(int pool) {
+    Chunk* c = _chunks[pool];
+    _chunks[pool] = NULL;
+    return c;
+  }
+
+  bool put(int pool, Chunk* c) {
+    if (_chunks[pool] != NULL) {
+      return false;
+    }
+    _chunks[pool] = c;
+    return true;
+  }
+
+  // Return all cached chunks to the global pools.
+  void flush();
+};
+
 //------------------------------Arena------------------------------------------
 // Fast allocation of memory
 class Arena : public CHeapObj<mtNone> {
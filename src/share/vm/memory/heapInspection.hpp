@@ -225,7 +225,7 @@ class KlassInfoBucket: public CHeapObj<mtInternal> {
   void iterate(KlassInfoClosure* cic);
 };
 
-class KlassInfoTable: public StackObj {
+class KlassInfoTable: public CHeapObj<mtInternal> {
  private:
   int _size;
   static const int _num_buckets = 20011;
@@ -251,6 +251,11 @@ class KlassInfoTable: public StackObj {
   KlassInfoTable(bool need_class_stats);
   ~KlassInfoTable();
   bool record_instance(const oop obj);
+  // Add the counts of another table, e.g. one filled by a GC worker
+  // while marking, to this table.  Returns false if an entry could not
+  // be allocated.
+  bool merge(KlassInfoTable* table);
+  bool merge_entry(const KlassInfoEntry* cie);
   void iterate(KlassInfoClosure* cic);
   bool allocation_failed() { return _buckets == NULL; }
   size_t size_of_instances_in_words() const;
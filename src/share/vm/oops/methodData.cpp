@@ -1157,6 +1157,7 @@ void MethodData::init() {
 
 #if INCLUDE_RTM_OPT
   _rtm_state = NoRTM; // No RTM lock eliding by default
+  _rtm_abort_deopts = 0;
   if (UseRTMLocking &&
       !CompilerOracle::has_option_string(_method, "NoRTMLockEliding")) {
     if (CompilerOracle::has_option_string(_method, "UseRTMLockEliding") || !UseRTMDeopt) {
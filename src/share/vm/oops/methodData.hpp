@@ -2092,6 +2092,9 @@ private:
 #if INCLUDE_RTM_OPT
   // State of RTM code generation during compilation of the method
   int               _rtm_state;
+  // Number of times RTM lock eliding was turned off because of a high
+  // abort ratio; kept across recompilations of the method
+  int               _rtm_abort_deopts;
 #endif
 
   // Number of loops and blocks is computed when compiling the first
@@ -2264,6 +2267,13 @@ public:
     Atomic::store((int)rstate, &_rtm_state);
   }
 
+  int rtm_abort_deopts() const {
+    return _rtm_abort_deopts;
+  }
+  void inc_rtm_abort_deopts() {
+    _rtm_abort_deopts++;
+  }
+
   static int rtm_state_offset_in_bytes() {
     return offset_of(MethodData, _rtm_state);
   }
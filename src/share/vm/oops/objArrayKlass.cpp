@@ -41,6 +41,7 @@
 #include "oops/oop.inline.hpp"
 #include "oops/oop.inline2.hpp"
 #include "oops/symbol.hpp"
+#include "oops/typeArrayKlass.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.inline.hpp"
@@ -202,6 +203,37 @@ objArrayOop ObjArrayKlass::allocate(int length, TRAPS) {
 
 static int multi_alloc_counter = 0;
 
+// Fills all of array with leaf arrays of the given klass and length if
+// they fit in the current TLAB together.  Returns the number of elements
+// filled in: all of them, or none.
+int ObjArrayKlass::batch_allocate_leaves(objArrayHandle array, KlassHandle leaf_klass,
+                                         int leaf_length, TRAPS) {
+  ArrayKlass* ak = ArrayKlass::cast(leaf_klass());
+  int count = array->length();
+  int size;
+  if (ak->oop_is_objArray()) {
+    if (leaf_length < 0 || leaf_length > arrayOopDesc::max_array_length(T_OBJECT)) {
+      return 0;
+    }
+    size = objArrayOopDesc::object_size(leaf_length);
+  } else {
+    if (leaf_length < 0 || leaf_length > TypeArrayKlass::cast(ak)->max_length()) {
+      return 0;
+    }
+    size = typeArrayOopDesc::object_size(ak->layout_helper(), leaf_length);
+  }
+  HeapWord* start = CollectedHeap::array_allocate_batch(leaf_klass, size, leaf_length,
+                                                        count, THREAD);
+  if (start == NULL) {
+    return 0;
+  }
+  // No safepoint until the leaves are reachable from array.
+  for (int index = 0; index < count; index++) {
+    array->obj_at_put(index, (oop) (start + (size_t) index * size));
+  }
+  return count;
+}
+
 oop ObjArrayKlass::multi_allocate(int rank, jint* sizes, TRAPS) {
   int length = *sizes;
   // Call to lower_dimension uses this pointer, so most be called before a
@@ -212,7 +244,13 @@ oop ObjArrayKlass::multi_allocate(int rank, jint* sizes, TRAPS) {
   objArrayHandle h_array (THREAD, array);
   if (rank > 1) {
     if (length != 0) {
-      for (int index = 0; index < length; index++) {
+      int index = 0;
+      if (rank == 2) {
+        // The sub-arrays are all leaves of the same length; try to place
+        // them next to each other with a single TLAB allocation.
+        index = batch_allocate_leaves(h_array, h_lower_dimension, sizes[1], THREAD);
+      }
+      for (; index < length; index++) {
         ArrayKlass* ak = ArrayKlass::cast(h_lower_dimension());
         oop sub_array = ak->multi_allocate(rank-1, &sizes[1], CHECK_NULL);
         h_array->obj_at_put(index, sub_array);
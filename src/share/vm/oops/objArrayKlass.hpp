@@ -41,6 +41,9 @@ class ObjArrayKlass : public ArrayKlass {
   // Constructor
   ObjArrayKlass(int n, KlassHandle element_klass, Symbol* name);
   static ObjArrayKlass* allocate(ClassLoaderData* loader_data, int n, KlassHandle klass_handle, Symbol* name, TRAPS);
+
+  static int batch_allocate_leaves(objArrayHandle array, KlassHandle leaf_klass,
+                                   int leaf_length, TRAPS);
  public:
   // For dummy objects
   ObjArrayKlass() {}
@@ -73,12 +73,7 @@ void Symbol::operator delete(void *p) {
 bool Symbol::equals(const char* str, int len) const {
   int l = utf8_length();
   if (l != len) return false;
-  while (l-- > 0) {
-    if (str[l] != (char) byte_at(l))
-      return false;
-  }
-  assert(l == -1, "we should be at the beginning");
-  return true;
+  return memcmp(str, base(), len) == 0;
 }
 
 
@@ -796,6 +796,14 @@ CallGenerator* CallGenerator::for_method_handle_inline(JVMState* jvms, ciMethod*
         assert(cg == NULL || !cg->is_late_inline() || cg->is_mh_late_inline(), "no late inline here");
         if (cg != NULL && cg->is_inline())
           return cg;
+      } else {
+        // A non-constant MethodHandle leaves the call going through the
+        // LambdaForm interpreter frames; report it.
+        const char* msg = "receiver not constant";
+        print_inlining(C, callee, jvms->depth() - 1, jvms->bci(), msg);
+        if (C->log() != NULL) {
+          C->log()->inline_fail(msg);
+        }
       }
     }
     break;
@@ -870,6 +878,12 @@ CallGenerator* CallGenerator::for_method_handle_inline(JVMState* jvms, ciMethod*
         assert(cg == NULL || !cg->is_late_inline() || cg->is_mh_late_inline(), "no late inline here");
         if (cg != NULL && cg->is_inline())
           return cg;
+      } else {
+        const char* msg = "member_name not constant";
+        print_inlining(C, callee, jvms->depth() - 1, jvms->bci(), msg);
+        if (C->log() != NULL) {
+          C->log()->inline_fail(msg);
+        }
       }
     }
     break;
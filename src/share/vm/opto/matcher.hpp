@@ -392,7 +392,7 @@ public:
 
   // Threshold small size (in bytes) for a ClearArray/CopyArray node.
   // Anything this size or smaller may get converted to discrete scalar stores.
-  static const int init_array_short_size;
+  static const int init_array_short_size();
 
   // Some hardware needs 2 CMOV's for longs.
   static const int long_cmove_cost();
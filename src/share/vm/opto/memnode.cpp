@@ -2784,7 +2784,7 @@ Node *ClearArrayNode::Ideal(PhaseGVN *phase, bool can_reshape){
   if (size <= 0 || size % unit != 0)  return NULL;
   intptr_t count = size / unit;
   // Length too long; use fast hardware clear
-  if (size > Matcher::init_array_short_size)  return NULL;
+  if (size > Matcher::init_array_short_size())  return NULL;
   Node *mem = in(1);
   if( phase->type(mem)==Type::TOP ) return NULL;
   Node *adr = in(3);
@@ -3980,7 +3980,7 @@ Node* InitializeNode::complete_stores(Node* rawctl, Node* rawmem, Node* rawptr,
                                               zeroes_done, zeroes_needed,
                                               phase);
         zeroes_done = zeroes_needed;
-        if (zsize > Matcher::init_array_short_size && ++big_init_gaps > 2)
+        if (zsize > Matcher::init_array_short_size() && ++big_init_gaps > 2)
           do_zeroing = false;   // leave the hole, next time
       }
     }
@@ -63,6 +63,7 @@
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/signature.hpp"
 #include "runtime/threadCritical.hpp"
+#include "runtime/timer.hpp"
 #include "runtime/vframe.hpp"
 #include "runtime/vframeArray.hpp"
 #include "runtime/vframe_hp.hpp"
@@ -137,6 +138,7 @@ static bool check_compiled_frame(JavaThread* thread) {
   if (var == NULL) { return false; }
 
 bool OptoRuntime::generate(ciEnv* env) {
+  TraceTime timer("C2 runtime stubs generation", TraceStartupTime);
 
   generate_exception_blob();
 
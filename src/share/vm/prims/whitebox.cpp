@@ -24,7 +24,9 @@
 
 #include "precompiled.hpp"
 
+#include "code/codeBlob.hpp"
 #include "memory/metadataFactory.hpp"
+#include "memory/oopFactory.hpp"
 #include "memory/universe.hpp"
 #include "oops/oop.inline.hpp"
 
@@ -35,8 +37,12 @@
 #include "prims/wbtestmethods/parserTests.hpp"
 
 #include "runtime/arguments.hpp"
+#include "runtime/biasedLocking.hpp"
 #include "runtime/interfaceSupport.hpp"
 #include "runtime/os.hpp"
+#include "runtime/synchronizer.hpp"
+#include "runtime/vm_operations.hpp"
+#include "runtime/vmThread.hpp"
 #include "utilities/array.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/macros.hpp"
@@ -924,6 +930,72 @@ WB_ENTRY(void, WB_ForceSafepoint(JNIEnv* env, jobject wb))
   VMThread::execute(&force_safepoint_op);
 WB_END
 
+// Micro benchmarks of VM-internal operations.  Each runs the operation
+// "iterations" times and returns the elapsed time in nanoseconds;
+// warmup and statistics are left to the Java side.
+
+WB_ENTRY(jlong, WB_BenchmarkSymbolLookup(JNIEnv* env, jobject wb, jstring name, jint iterations))
+  ResourceMark rm(THREAD);
+  const char* utf = java_lang_String::as_utf8_string(JNIHandles::resolve_non_null(name));
+  int len = (int) strlen(utf);
+  jlong start = os::javaTimeNanos();
+  for (jint i = 0; i < iterations; i++) {
+    TempNewSymbol sym = SymbolTable::lookup(utf, len, CHECK_0);
+  }
+  return os::javaTimeNanos() - start;
+WB_END
+
+WB_ENTRY(jlong, WB_BenchmarkMonitorInflation(JNIEnv* env, jobject wb, jint iterations))
+  // Allocate the objects up front so only inflation is timed.
+  objArrayOop a = oopFactory::new_objArray(SystemDictionary::Object_klass(), iterations, CHECK_0);
+  objArrayHandle objs(THREAD, a);
+  InstanceKlass* ik = InstanceKlass::cast(SystemDictionary::Object_klass());
+  for (jint i = 0; i < iterations; i++) {
+    oop o = ik->allocate_instance(CHECK_0);
+    objs->obj_at_put(i, o);
+    if (UseBiasedLocking) {
+      // inflate() expects an unbiased header.
+      Handle h_obj(THREAD, o);
+      BiasedLocking::revoke_and_rebias(h_obj, false, THREAD);
+    }
+  }
+  jlong start = os::javaTimeNanos();
+  for (jint i = 0; i < iterations; i++) {
+    ObjectSynchronizer::inflate(THREAD, objs->obj_at(i));
+  }
+  return os::javaTimeNanos() - start;
+WB_END
+
+WB_ENTRY(jlong, WB_BenchmarkTLABAllocation(JNIEnv* env, jobject wb, jint length, jint iterations))
+  jlong start = os::javaTimeNanos();
+  for (jint i = 0; i < iterations; i++) {
+    oopFactory::new_typeArray(T_BYTE, length, CHECK_0);
+  }
+  return os::javaTimeNanos() - start;
+WB_END
+
+WB_ENTRY(jlong, WB_BenchmarkSafepoint(JNIEnv* env, jobject wb, jint iterations))
+  jlong start = os::javaTimeNanos();
+  for (jint i = 0; i < iterations; i++) {
+    VM_ForceSafepoint force_safepoint_op;
+    VMThread::execute(&force_safepoint_op);
+  }
+  return os::javaTimeNanos() - start;
+WB_END
+
+// Returns -1 if the code cache is full.
+WB_ENTRY(jlong, WB_BenchmarkCodeCacheAllocation(JNIEnv* env, jobject wb, jint size, jint iterations))
+  jlong start = os::javaTimeNanos();
+  for (jint i = 0; i < iterations; i++) {
+    BufferBlob* blob = BufferBlob::create("WB::BenchmarkBlob", size);
+    if (blob == NULL) {
+      return -1;
+    }
+    BufferBlob::free(blob);
+  }
+  return os::javaTimeNanos() - start;
+WB_END
+
 //Some convenience methods to deal with objects from java
 int WhiteBox::offset_for_field(const char* field_name, oop object,
     Symbol* signature_symbol) {
@@ -1115,6 +1187,15 @@ static JNINativeMethod methods[] = {
                                                       (void*)&WB_GetNMethod         },
   {CC"isMonitorInflated",  CC"(Ljava/lang/Object;)Z", (void*)&WB_IsMonitorInflated  },
   {CC"forceSafepoint",     CC"()V",                   (void*)&WB_ForceSafepoint     },
+  {CC"benchmarkSymbolLookup",
+                           CC"(Ljava/lang/String;I)J", (void*)&WB_BenchmarkSymbolLookup },
+  {CC"benchmarkMonitorInflation",
+                           CC"(I)J",                   (void*)&WB_BenchmarkMonitorInflation },
+  {CC"benchmarkTLABAllocation",
+                           CC"(II)J",                  (void*)&WB_BenchmarkTLABAllocation },
+  {CC"benchmarkSafepoint", CC"(I)J",                   (void*)&WB_BenchmarkSafepoint },
+  {CC"benchmarkCodeCacheAllocation",
+                           CC"(II)J",                  (void*)&WB_BenchmarkCodeCacheAllocation },
 };
 
 #undef CC
@@ -36,6 +36,7 @@ class BasicLock VALUE_OBJ_CLASS_SPEC {
  public:
   markOop      displaced_header() const               { return _displaced_header; }
   void         set_displaced_header(markOop header)   { _displaced_header = header; }
+  volatile markOop* displaced_header_addr()           { return &_displaced_header; }
 
   void print_on(outputStream* st) const;
 
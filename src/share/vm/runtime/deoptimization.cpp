@@ -1619,12 +1619,22 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* thread, jint tra
       }
 
 #if INCLUDE_RTM_OPT
+      // Remember how often the abort ratio calculation turned RTM lock
+      // eliding off for this method.
+      if ((reason == Reason_rtm_state_change) && (trap_mdo != NULL) &&
+          ((trap_mdo->rtm_state() & NoRTM) != 0)) {
+        trap_mdo->inc_rtm_abort_deopts();
+      }
       // Restart collecting RTM locking abort statistic if the method
       // is recompiled for a reason other than RTM state change.
       // Assume that in new recompiled code the statistic could be different,
-      // for example, due to different inlining.
+      // for example, due to different inlining.  A method whose locks kept
+      // aborting in RTMAbortDeoptLimit profiled compilations stays with
+      // normal locking instead of paying for the aborts again.
       if ((reason != Reason_rtm_state_change) && (trap_mdo != NULL) &&
-          UseRTMDeopt && (nm->rtm_state() != ProfileRTM)) {
+          UseRTMDeopt && (nm->rtm_state() != ProfileRTM) &&
+          (nm->rtm_state() != NoRTM ||
+           trap_mdo->rtm_abort_deopts() < RTMAbortDeoptLimit)) {
         trap_mdo->atomic_set_rtm_state(ProfileRTM);
       }
 #endif
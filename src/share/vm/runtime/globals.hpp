@@ -1139,6 +1139,10 @@ class CommandLineFlags {
                                                                             \
   product(bool, MonitorInUseLists, false, "Track Monitors for Deflation")   \
                                                                             \
+  diagnostic(bool, RetainContendedMonitors, false,                          \
+          "Do not deflate monitors that were contended since the last "     \
+          "deflation pass, keeping their contention statistics")            \
+                                                                            \
   product(intx, SyncFlags, 0, "(Unsafe, Unstable) Experimental Sync flags") \
                                                                             \
   product(intx, SyncVerbose, 0, "(Unstable)")                               \
@@ -1379,7 +1383,7 @@ class CommandLineFlags {
   notproduct(bool, TraceZapDeadLocals, false,                               \
           "Trace zapping dead locals")                                      \
                                                                             \
-  develop(bool, TraceStartupTime, false,                                    \
+  diagnostic(bool, TraceStartupTime, false,                                 \
           "Trace setup time")                                               \
                                                                             \
   develop(bool, TraceProtectionDomainVerification, false,                   \
@@ -2011,6 +2015,10 @@ class CommandLineFlags {
   experimental(uintx, WorkStealingSpinToYieldRatio, 10,                     \
           "Ratio of hard spins to calls to yield")                          \
                                                                             \
+  experimental(bool, UseOWSTTaskTerminator, true,                           \
+          "Let only one thread spin during work stealing termination and "  \
+          "block the others until tasks become available")                  \
+                                                                            \
   develop(uintx, ObjArrayMarkingStride, 512,                                \
           "Number of object array elements to push onto the marking stack " \
           "before pushing a continuation entry")                            \
@@ -3722,6 +3730,10 @@ class CommandLineFlags {
           "Flag to disable jvmstat instrumentation for performance testing "\
           "and problem isolation purposes")                                 \
                                                                             \
+  product(bool, UsePerfMap, false,                                          \
+          "Write the address range and name of generated code to "          \
+          "/tmp/perf-<pid>.map for use by the Linux perf tool")             \
+                                                                            \
   product(bool, PerfDataSaveToFile, false,                                  \
           "Save PerfData memory to hsperfdata_<pid> file on exit")          \
                                                                             \
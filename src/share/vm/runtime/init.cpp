@@ -50,6 +50,7 @@ void management_init();
 void bytecodes_init();
 void classLoader_init();
 void codeCache_init();
+void perfMap_init();
 void VM_Version_init();
 void os_init_globals();        // depends on VM_Version_init, before universe_init
 void stubRoutines_init1();
@@ -98,6 +99,7 @@ jint init_globals() {
   bytecodes_init();
   classLoader_init();
   codeCache_init();
+  perfMap_init();      // before any code is generated
   VM_Version_init();
   os_init_globals();
   stubRoutines_init1();
@@ -27,6 +27,7 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "code/codeCache.hpp"
+#include "code/perfMap.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
 #include "interpreter/bytecodeHistogram.hpp"
@@ -490,6 +491,9 @@ void before_exit(JavaThread * thread) {
   if (PeriodicTask::num_tasks() > 0)
     WatcherThread::stop();
 
+  // Write out the remaining perf map entries
+  PerfMap::destroy();
+
   // Print statistics gathered (profiling ...)
   if (Arguments::has_profile()) {
     FlatProfiler::disengage();
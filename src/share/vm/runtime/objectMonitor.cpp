@@ -360,6 +360,7 @@ void ATTR ObjectMonitor::enter(TRAPS) {
      assert (_recursions == 0    , "invariant") ;
      assert (((oop)(object()))->mark() == markOopDesc::encode(this), "invariant") ;
      Self->_Stalled = 0 ;
+     record_contended_enter (true, 0) ;
      return ;
   }
 
@@ -376,6 +377,7 @@ void ATTR ObjectMonitor::enter(TRAPS) {
   // Ensure the object-monitor relationship remains stable while there's contention.
   Atomic::inc_ptr(&_count);
 
+  const jlong contended_start = os::javaTimeNanos() ;
   EventJavaMonitorEnter event;
 
   { // Change java thread status to indicate blocked on monitor enter.
@@ -441,6 +443,8 @@ void ATTR ObjectMonitor::enter(TRAPS) {
   assert (_succ  != Self       , "invariant") ;
   assert (((oop)(object()))->mark() == markOopDesc::encode(this), "invariant") ;
 
+  record_contended_enter (false, os::javaTimeNanos() - contended_start) ;
+
   // The thread -- now the owner -- is back in vm mode.
   // Report the glorious news via TI,DTrace and jvmstat.
   // The probe effect is non-trivial.  All the reportage occurs
@@ -902,6 +906,27 @@ void ObjectMonitor::UnlinkAfterAcquire (Thread * Self, ObjectWaiter * SelfNode)
     SelfNode->TState = ObjectWaiter::TS_RUN ;
 }
 
+// Caller has just acquired the monitor after finding it owned by another
+// thread.  Since only the owner updates the statistics, no atomics are needed.
+// The statistics are reported by the Thread.monitor_contention diagnostic
+// command.  With -XX:+RetainContendedMonitors, _recent_contention keeps
+// deflate_idle_monitors() from deflating (and thereby discarding the
+// statistics of) hot monitors.
+
+void ObjectMonitor::record_contended_enter (bool spun, jlong blocked_nanos) {
+  assert (_owner == Thread::current(), "invariant") ;
+  _contended_enters ++ ;
+  _recent_contention = 1 ;
+  if (spun) {
+    _spin_enters ++ ;
+  } else {
+    _blocked_nanos += blocked_nanos ;
+    if (blocked_nanos > _max_blocked_nanos) {
+      _max_blocked_nanos = blocked_nanos ;
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 // Exit support
 //
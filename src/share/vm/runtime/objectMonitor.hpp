@@ -130,6 +130,12 @@ class ObjectMonitor {
   intptr_t  contentions() const ;
   intptr_t  recursions() const                                         { return _recursions; }
 
+  // Contention statistics, see enter()
+  intptr_t  contended_enters() const                                   { return _contended_enters; }
+  intptr_t  spin_enters() const                                        { return _spin_enters; }
+  jlong     blocked_nanos() const                                      { return _blocked_nanos; }
+  jlong     max_blocked_nanos() const                                  { return _max_blocked_nanos; }
+
   // JVM/DI GetMonitorInfo() needs this
   ObjectWaiter* first_waiter()                                         { return _WaitSet; }
   ObjectWaiter* next_waiter(ObjectWaiter* o)                           { return o->_next; }
@@ -155,6 +161,11 @@ class ObjectMonitor {
     _SpinClock    = 0 ;
     OwnerIsThread = 0 ;
     _previous_owner_tid = 0;
+    _contended_enters  = 0 ;
+    _spin_enters       = 0 ;
+    _blocked_nanos     = 0 ;
+    _max_blocked_nanos = 0 ;
+    _recent_contention = 0 ;
   }
 
   ~ObjectMonitor() {
@@ -178,6 +189,11 @@ private:
     _SpinFreq      = 0 ;
     _SpinClock     = 0 ;
     OwnerIsThread  = 0 ;
+    _contended_enters  = 0 ;
+    _spin_enters       = 0 ;
+    _blocked_nanos     = 0 ;
+    _max_blocked_nanos = 0 ;
+    _recent_contention = 0 ;
   }
 
 public:
@@ -221,6 +237,7 @@ public:
   int       TrySpin_VaryDuration  (Thread * Self) ;
   void      ctAsserts () ;
   void      ExitEpilog (Thread * Self, ObjectWaiter * Wakee) ;
+  void      record_contended_enter (bool spun, jlong blocked_nanos) ;
   bool      ExitSuspendEquivalent (JavaThread * Self) ;
   void      post_monitor_wait_event(EventJavaMonitorWait * event,
                                                    jlong notifier_tid,
@@ -283,6 +300,15 @@ public:
  private:
   volatile int _WaitSetLock;        // protects Wait Queue - simple spinlock
 
+  // Contention statistics.  These are only updated by a thread that has
+  // just acquired the monitor after finding it owned, so the monitor
+  // itself serializes the updates.  Reset when the monitor is recycled.
+  intptr_t _contended_enters ;      // enters that found the monitor owned
+  intptr_t _spin_enters ;           // ... of which were satisfied by spinning
+  jlong    _blocked_nanos ;         // total time spent blocked in EnterI
+  jlong    _max_blocked_nanos ;     // longest single blocked enter
+  int      _recent_contention ;     // contended since the last deflation pass
+
  public:
   int _QMix ;                       // Mixed prepend queue discipline
   ObjectMonitor * FreeNext ;        // Free list linkage
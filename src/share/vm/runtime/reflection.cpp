@@ -900,6 +900,31 @@ methodHandle Reflection::resolve_interface_call(instanceKlassHandle klass, metho
 }
 
 
+// Select the implementation of an interface method through the receiver's
+// itable, as invokeinterface does.  Returns NULL if there is no usable
+// entry; the caller then falls back to resolve_interface_call, which
+// reports the appropriate error.
+static Method* select_interface_method(Klass* recv_klass, Method* reflected_method) {
+  if (!recv_klass->oop_is_instance() || !reflected_method->has_itable_index()) {
+    return NULL;
+  }
+  InstanceKlass* ik = InstanceKlass::cast(recv_klass);
+  Klass* holder = reflected_method->method_holder();
+  // The itable is terminated by an entry with a NULL interface.
+  for (itableOffsetEntry* ioe = (itableOffsetEntry*)ik->start_of_itable();
+       ioe->interface_klass() != NULL; ioe++) {
+    if (ioe->interface_klass() == holder) {
+      Method* m = ioe->first_method_entry(ik)[reflected_method->itable_index()].method();
+      if (m != NULL && m->is_public() && !m->is_abstract()) {
+        return m;
+      }
+      return NULL;
+    }
+  }
+  return NULL;
+}
+
+
 oop Reflection::invoke(instanceKlassHandle klass, methodHandle reflected_method,
                        Handle receiver, bool override, objArrayHandle ptypes,
                        BasicType rtype, objArrayHandle args, bool is_method_invoke, TRAPS) {
@@ -933,8 +958,12 @@ oop Reflection::invoke(instanceKlassHandle klass, methodHandle reflected_method,
     } else {
       // resolve based on the receiver
       if (reflected_method->method_holder()->is_interface()) {
-        // resolve interface call
-        if (ReflectionWrapResolutionErrors) {
+        // Try the receiver's itable first; a full link resolution on
+        // every reflective interface call is expensive.
+        Method* selected = select_interface_method(target_klass(), reflected_method());
+        if (selected != NULL) {
+          method = methodHandle(THREAD, selected);
+        } else if (ReflectionWrapResolutionErrors) {
           // new default: 6531596
           // Match resolution errors with those thrown due to reflection inlining
           // Linktime resolution & IllegalAccessCheck already done by Class.getMethod()
@@ -27,6 +27,7 @@
 #include "classfile/vmSymbols.hpp"
 #include "code/compiledIC.hpp"
 #include "code/scopeDesc.hpp"
+#include "code/perfMap.hpp"
 #include "code/vtableStubs.hpp"
 #include "compiler/abstractCompiler.hpp"
 #include "compiler/compileBroker.hpp"
@@ -50,6 +51,7 @@
 #include "runtime/javaCalls.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/stubRoutines.hpp"
+#include "runtime/timer.hpp"
 #include "runtime/vframe.hpp"
 #include "runtime/vframeArray.hpp"
 #include "utilities/copy.hpp"
@@ -104,6 +106,7 @@ UncommonTrapBlob*   SharedRuntime::_uncommon_trap_blob;
 
 //----------------------------generate_stubs-----------------------------------
 void SharedRuntime::generate_stubs() {
+  TraceTime timer("SharedRuntime stubs generation", TraceStartupTime);
   _wrong_method_blob                   = generate_resolve_blob(CAST_FROM_FN_PTR(address, SharedRuntime::handle_wrong_method),          "wrong_method_stub");
   _wrong_method_abstract_blob          = generate_resolve_blob(CAST_FROM_FN_PTR(address, SharedRuntime::handle_wrong_method_abstract), "wrong_method_abstract_stub");
   _ic_miss_blob                        = generate_resolve_blob(CAST_FROM_FN_PTR(address, SharedRuntime::handle_wrong_method_ic_miss),  "ic_miss_stub");
@@ -2361,7 +2364,10 @@ BufferBlob* AdapterHandlerLibrary::buffer_blob() {
 
 void AdapterHandlerLibrary::initialize() {
   if (_adapters != NULL) return;
-  _adapters = new AdapterHandlerTable();
+  // get_adapter reads _adapters without the lock, so only publish the
+  // table once it is fully constructed.
+  AdapterHandlerTable* adapters = new AdapterHandlerTable();
+  OrderAccess::release_store_ptr(&_adapters, adapters);
 
   // Create a special handler for abstract methods.  Abstract methods
   // are never compiled so an i2c entry is somewhat meaningless, but
@@ -2381,11 +2387,30 @@ AdapterHandlerEntry* AdapterHandlerLibrary::new_entry(AdapterFingerPrint* finger
   return _adapters->new_entry(fingerprint, i2c_entry, c2i_entry, c2i_unverified_entry);
 }
 
+// Fill in the signature array for the calling-convention call and
+// return the number of Java argument slots.
+static int adapter_signature(methodHandle method, BasicType*& sig_bt) {
+  int total_args_passed = method->size_of_parameters(); // All args on stack
+
+  sig_bt = NEW_RESOURCE_ARRAY(BasicType, total_args_passed);
+  int i = 0;
+  if (!method->is_static())  // Pass in receiver first
+    sig_bt[i++] = T_OBJECT;
+  for (SignatureStream ss(method->signature()); !ss.at_return_type(); ss.next()) {
+    sig_bt[i++] = ss.type();  // Collect remaining bits of signature
+    if (ss.type() == T_LONG || ss.type() == T_DOUBLE)
+      sig_bt[i++] = T_VOID;   // Longs & doubles take 2 Java slots
+  }
+  assert(i == total_args_passed, "");
+  return total_args_passed;
+}
+
 AdapterHandlerEntry* AdapterHandlerLibrary::get_adapter(methodHandle method) {
-  // Use customized signature handler.  Need to lock around updates to
-  // the AdapterHandlerTable (it is not safe for concurrent readers
-  // and a single writer: this could be fixed if it becomes a
-  // problem).
+  // Use customized signature handler.  Updates to the AdapterHandlerTable
+  // are made under the AdapterHandlerLibrary_lock.  Entries are never
+  // removed and are published with a releasing store (see
+  // HashtableBucket::set_entry), so the common case of a signature that
+  // already has an adapter is looked up without taking the lock.
 
   // Get the address of the ic_miss handlers before we grab the
   // AdapterHandlerLibrary_lock. This fixes bug 6236259 which
@@ -2402,6 +2427,18 @@ AdapterHandlerEntry* AdapterHandlerLibrary::get_adapter(methodHandle method) {
   AdapterBlob* new_adapter = NULL;
   AdapterHandlerEntry* entry = NULL;
   AdapterFingerPrint* fingerprint = NULL;
+  BasicType* sig_bt = NULL;
+  int total_args_passed = -1;
+
+  // Fast path: no lock needed once the table exists.
+  if (_adapters != NULL && !method->is_abstract() && !VerifyAdapterSharing) {
+    total_args_passed = adapter_signature(method, sig_bt);
+    entry = _adapters->lookup(total_args_passed, sig_bt);
+    if (entry != NULL) {
+      return entry;
+    }
+  }
+
   {
     MutexLocker mu(AdapterHandlerLibrary_lock);
     // make sure data structure is initialized
@@ -2412,19 +2449,10 @@ AdapterHandlerEntry* AdapterHandlerLibrary::get_adapter(methodHandle method) {
     }
 
     // Fill in the signature array, for the calling-convention call.
-    int total_args_passed = method->size_of_parameters(); // All args on stack
-
-    BasicType* sig_bt = NEW_RESOURCE_ARRAY(BasicType, total_args_passed);
-    VMRegPair* regs   = NEW_RESOURCE_ARRAY(VMRegPair, total_args_passed);
-    int i = 0;
-    if (!method->is_static())  // Pass in receiver first
-      sig_bt[i++] = T_OBJECT;
-    for (SignatureStream ss(method->signature()); !ss.at_return_type(); ss.next()) {
-      sig_bt[i++] = ss.type();  // Collect remaining bits of signature
-      if (ss.type() == T_LONG || ss.type() == T_DOUBLE)
-        sig_bt[i++] = T_VOID;   // Longs & doubles take 2 Java slots
+    if (sig_bt == NULL) {
+      total_args_passed = adapter_signature(method, sig_bt);
     }
-    assert(i == total_args_passed, "");
+    VMRegPair* regs = NEW_RESOURCE_ARRAY(VMRegPair, total_args_passed);
 
     // Lookup method signature's fingerprint
     entry = _adapters->lookup(total_args_passed, sig_bt);
@@ -2528,6 +2556,7 @@ AdapterHandlerEntry* AdapterHandlerLibrary::get_adapter(methodHandle method) {
                  fingerprint->as_string(),
                  new_adapter->content_begin());
     Forte::register_stub(blob_id, new_adapter->content_begin(),new_adapter->content_end());
+    PerfMap::register_stub(blob_id, new_adapter->content_begin(), new_adapter->content_end());
 
     if (JvmtiExport::should_post_dynamic_code_generated()) {
       JvmtiExport::post_dynamic_code_generated(blob_id, new_adapter->content_begin(), new_adapter->content_end());
@@ -664,21 +664,30 @@ intptr_t ObjectSynchronizer::FastHashCode (Thread * Self, oop obj) {
     }
     // Skip to the following code to reduce code size
   } else if (Self->is_lock_owned((address)mark->locker())) {
-    temp = mark->displaced_mark_helper(); // this is a lightweight monitor owned
+    BasicLock * lock = mark->locker();
+    temp = lock->displaced_header();  // this is a lightweight monitor owned
     assert (temp->is_neutral(), "invariant") ;
     hash = temp->hash();              // by current thread, check if the displaced
     if (hash) {                       // header contains hash code
       return hash;
     }
-    // WARNING:
-    //   The displaced header is strictly immutable.
-    // It can NOT be changed in ANY cases. So we have
-    // to inflate the header into heavyweight monitor
-    // even the current thread owns the lock. The reason
-    // is the BasicLock (stack slot) will be asynchronously
-    // read by other threads during the inflate() function.
-    // Any change to stack may not propagate to other threads
-    // correctly.
+    // The displaced header is read asynchronously by other threads only
+    // in inflate(), and only after they have swung the mark word to
+    // INFLATING.  So the owner may install the hash code directly into
+    // the displaced header provided it then observes that the mark word
+    // still refers to its BasicLock: any inflater that has not yet
+    // installed INFLATING will fetch the updated displaced header.  If
+    // the mark word changed underneath us, the inflater may have seen
+    // the old displaced header; the update is then simply ignored and
+    // we fall through to the inflated path below.  This avoids inflating
+    // locks merely because their owner asked for the identity hash.
+    hash = get_next_hash(Self, obj);
+    test = temp->copy_set_hash(hash);
+    if ((markOop) Atomic::cmpxchg_ptr(test, (volatile void*) lock->displaced_header_addr(), temp) == temp &&
+        obj->mark() == mark) {
+      TEVENT (FastHashCode: hash installed in displaced header) ;
+      return hash;
+    }
   }
 
   // Inflate the monitor to set hash code
@@ -842,6 +851,56 @@ void ObjectSynchronizer::monitors_iterate(MonitorClosure* closure) {
   }
 }
 
+static int compare_contended_enters(ObjectMonitor** m1, ObjectMonitor** m2) {
+  intptr_t c1 = (*m1)->contended_enters();
+  intptr_t c2 = (*m2)->contended_enters();
+  return (c1 > c2) ? -1 : ((c1 < c2) ? 1 : 0);
+}
+
+// Print the inflated monitors with the most contended enters, together with
+// the stack of their current owners.  Used by the Thread.monitor_contention
+// diagnostic command.
+void ObjectSynchronizer::print_contended_monitors(outputStream* st, int max_monitors) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  ResourceMark rm;
+  GrowableArray<ObjectMonitor*>* contended = new GrowableArray<ObjectMonitor*>(64);
+  for (ObjectMonitor* block = gBlockList; block != NULL; block = (ObjectMonitor*) block->FreeNext) {
+    assert(block->object() == CHAINMARKER, "must be a block header");
+    for (int i = 1; i < _BLOCKSIZE; i++) {
+      ObjectMonitor* mid = &block[i];
+      if (mid->object() != NULL && mid->contended_enters() > 0) {
+        contended->append(mid);
+      }
+    }
+  }
+  contended->sort(compare_contended_enters);
+
+  st->print_cr("Contended monitors: %d", contended->length());
+  for (int i = 0; i < contended->length() && i < max_monitors; i++) {
+    ObjectMonitor* mid = contended->at(i);
+    oop obj = (oop) mid->object();
+    st->cr();
+    st->print_cr("<" INTPTR_FORMAT "> (a %s)", (intptr_t)(address)obj, obj->klass()->external_name());
+    st->print_cr("   contended enters: " INTX_FORMAT ", acquired by spinning: " INTX_FORMAT,
+                 mid->contended_enters(), mid->spin_enters());
+    st->print_cr("   blocked: total %.3f ms, max %.3f ms, waiting to enter: " INTX_FORMAT,
+                 (double) mid->blocked_nanos() / NANOSECS_PER_MILLISEC,
+                 (double) mid->max_blocked_nanos() / NANOSECS_PER_MILLISEC,
+                 mid->contentions());
+    if (mid->owner() == NULL) {
+      st->print_cr("   owner: none");
+      continue;
+    }
+    JavaThread* owner = Threads::owning_thread_from_monitor_owner((address) mid->owner(), false);
+    if (owner == NULL) {
+      st->print_cr("   owner: unknown");
+      continue;
+    }
+    st->print_cr("   owner: \"%s\"", owner->get_thread_name());
+    owner->print_stack_on(st);
+  }
+}
+
 // Get the next block in the block list.
 static inline ObjectMonitor* next(ObjectMonitor* block) {
   assert(block->object() == CHAINMARKER, "must be a block header");
@@ -1432,6 +1491,14 @@ bool ObjectSynchronizer::deflate_monitor(ObjectMonitor* mid, oop obj,
   if (mid->is_busy()) {
      if (ClearResponsibleAtSTW) mid->_Responsible = NULL ;
      deflated = false;
+  } else if (RetainContendedMonitors && mid->_recent_contention != 0) {
+     // The monitor was contended since the last deflation pass.  Keep it
+     // inflated for one more interval: this avoids inflate/deflate churn
+     // on hot locks and retains their contention statistics.  Note that
+     // the object stays strongly reachable while the monitor is in use.
+     TEVENT (deflate_idle_monitors - retain contended) ;
+     mid->_recent_contention = 0;
+     deflated = false;
   } else {
      // Deflate the monitor if it is no longer being used
      // It's idle - scavenge and return to the global free list
@@ -109,6 +109,9 @@ class ObjectSynchronizer : AllStatic {
   static void release_monitors_owned_by_thread(TRAPS);
   static void monitors_iterate(MonitorClosure* m);
 
+  // Print the most contended inflated monitors and their owners (at safepoint)
+  static void print_contended_monitors(outputStream* st, int max_monitors);
+
   // GC: we current use aggressive monitor deflation policy
   // Basically we deflate all monitors that are not busy.
   // An adaptive profile-based deflation policy could be used if needed
@@ -257,6 +257,7 @@ Thread::Thread() {
   omFreeProvision = 32 ;
   omInUseList = NULL ;
   omInUseCount = 0 ;
+  _uses_chunk_cache = false;
 
 #ifdef ASSERT
   _visited_for_critical_count = false;
@@ -342,6 +343,10 @@ Thread::~Thread() {
   // Reclaim the objectmonitors from the omFreeList of the moribund thread.
   ObjectSynchronizer::omFlush (this) ;
 
+  // Chunks freed from here on go straight back to the global pools.
+  set_uses_chunk_cache(false);
+  _chunk_cache.flush();
+
   EVENT_THREAD_DESTRUCT(this);
 
   // stack_base can be NULL if the thread is never started or exited before
@@ -1209,6 +1214,7 @@ void JavaThread::allocate_threadObj(Handle thread_group, char* thread_name, bool
 NamedThread::NamedThread() : Thread() {
   _name = NULL;
   _processed_thread = NULL;
+  set_uses_chunk_cache(true);
 }
 
 NamedThread::~NamedThread() {
@@ -1240,6 +1246,7 @@ volatile bool  WatcherThread::_should_terminate = false;
 
 WatcherThread::WatcherThread() : Thread(), _crash_protection(NULL) {
   assert(watcher_thread() == NULL, "we can only allocate one WatcherThread");
+  set_uses_chunk_cache(true);
   if (os::create_thread(this, os::watcher_thread)) {
     _watcher_thread = this;
 
@@ -3241,6 +3248,7 @@ CompilerThread::CompilerThread(CompileQueue* queue, CompilerCounters* counters)
   _buffer_blob = NULL;
   _scanned_nmethod = NULL;
   _compiler = NULL;
+  set_uses_chunk_cache(true);
 
 #ifndef PRODUCT
   _ideal_graph_printer = NULL;
@@ -284,6 +284,18 @@ class Thread: public ThreadShadow {
   ObjectMonitor* omInUseList;                   // SLL to track monitors in circulation
   int omInUseCount;                             // length of omInUseList
 
+  // Thread-local cache of free arena chunks.  Only used by threads with a
+  // bounded population (VM, GC, compiler and watcher threads); see
+  // ChunkPool in allocation.cpp.
+ private:
+  ChunkCache _chunk_cache;
+  bool _uses_chunk_cache;
+
+ public:
+  ChunkCache* chunk_cache()                     { return &_chunk_cache; }
+  bool uses_chunk_cache() const                 { return _uses_chunk_cache; }
+  void set_uses_chunk_cache(bool v)             { _uses_chunk_cache = v; }
+
 #ifdef ASSERT
  private:
   bool _visited_for_critical_count;
@@ -210,6 +210,10 @@ void VM_PrintJNI::doit() {
   JNIHandles::print_on(_out);
 }
 
+void VM_PrintContendedMonitors::doit() {
+  ObjectSynchronizer::print_contended_monitors(_out, _max_monitors);
+}
+
 VM_FindDeadlocks::~VM_FindDeadlocks() {
   if (_deadlocks != NULL) {
     DeadlockCycle* cycle = _deadlocks;
@@ -43,6 +43,7 @@
   template(ThreadStop)                            \
   template(ThreadDump)                            \
   template(PrintThreads)                          \
+  template(PrintContendedMonitors)                \
   template(FindDeadlocks)                         \
   template(ForceSafepoint)                        \
   template(ForceAsyncSafepoint)                   \
@@ -325,6 +326,16 @@ class VM_PrintJNI: public VM_Operation {
   void doit();
 };
 
+class VM_PrintContendedMonitors: public VM_Operation {
+ private:
+  outputStream* _out;
+  int           _max_monitors;
+ public:
+  VM_PrintContendedMonitors(outputStream* out, int max_monitors) : _out(out), _max_monitors(max_monitors) {}
+  VMOp_Type type() const                { return VMOp_PrintContendedMonitors; }
+  void doit();
+};
+
 class DeadlockCycle;
 class VM_FindDeadlocks: public VM_Operation {
  private:
@@ -55,6 +55,7 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassStatsDCmd>(full_export, true, false));
 #endif // INCLUDE_SERVICES
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ThreadDumpDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<MonitorContentionDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<RotateGCLogDCmd>(full_export, true, false));
 
   // Enhanced JMX Agent Support
@@ -427,6 +428,32 @@ int ThreadDumpDCmd::num_arguments() {
   }
 }
 
+MonitorContentionDCmd::MonitorContentionDCmd(outputStream* output, bool heap) :
+                                             DCmdWithParser(output, heap),
+  _top("-top", "Number of monitors to print", "INT", false, "10") {
+  _dcmdparser.add_dcmd_option(&_top);
+}
+
+void MonitorContentionDCmd::execute(DCmdSource source, TRAPS) {
+  if (_top.value() < 0) {
+    THROW_MSG(vmSymbols::java_lang_IllegalArgumentException(),
+              "Number of monitors must be non-negative");
+  }
+  VM_PrintContendedMonitors op(output(), (int) MIN2(_top.value(), (jlong) max_jint));
+  VMThread::execute(&op);
+}
+
+int MonitorContentionDCmd::num_arguments() {
+  ResourceMark rm;
+  MonitorContentionDCmd* dcmd = new MonitorContentionDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
 // Enhanced JMX Agent support
 
 JMXStartRemoteDCmd::JMXStartRemoteDCmd(outputStream *output, bool heap_allocated) :
@@ -271,6 +271,27 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class MonitorContentionDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<jlong> _top;
+public:
+  MonitorContentionDCmd(outputStream* output, bool heap);
+  static const char* name() { return "Thread.monitor_contention"; }
+  static const char* description() {
+    return "Print the most contended inflated monitors with the stacks of their owners.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the number of inflated monitors.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 // Enhanced JMX Agent support
 
 class JMXStartRemoteDCmd : public DCmdWithParser {
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2015, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_UTILITIES_COUNT_TRAILING_ZEROS_HPP
+#define SHARE_VM_UTILITIES_COUNT_TRAILING_ZEROS_HPP
+
+#include "utilities/debug.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+#ifdef TARGET_COMPILER_visCPP
+#include <intrin.h>
+#endif
+
+// Return the number of low order 0 bits in x, i.e. the bit index of the
+// lowest set bit.  x must not be zero.
+inline unsigned count_trailing_zeros(uintx x) {
+  assert(x != 0, "precondition");
+#if defined(TARGET_COMPILER_gcc)
+  return __builtin_ctzl(x);
+#elif defined(TARGET_COMPILER_visCPP)
+  unsigned long index;
+#ifdef _LP64
+  _BitScanForward64(&index, x);
+#else
+  _BitScanForward(&index, x);
+#endif
+  return index;
+#else
+  unsigned n = 0;
+#ifdef _LP64
+  if ((x & 0xFFFFFFFF) == 0) { n += 32; x >>= 32; }
+#endif
+  if ((x & 0xFFFF) == 0) { n += 16; x >>= 16; }
+  if ((x & 0xFF) == 0)   { n += 8;  x >>= 8; }
+  if ((x & 0xF) == 0)    { n += 4;  x >>= 4; }
+  if ((x & 0x3) == 0)    { n += 2;  x >>= 2; }
+  if ((x & 0x1) == 0)    { n += 1; }
+  return n;
+#endif
+}
+
+#endif // SHARE_VM_UTILITIES_COUNT_TRAILING_ZEROS_HPP
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/thread.inline.hpp"
 #include "utilities/debug.hpp"
@@ -130,10 +131,32 @@ int TaskQueueSetSuper::randomParkAndMiller(int *seed0) {
 }
 
 ParallelTaskTerminator::
-ParallelTaskTerminator(int n_threads, TaskQueueSetSuper* queue_set) :
+ParallelTaskTerminator(int n_threads, TaskQueueSetSuper* queue_set,
+                       bool may_block) :
   _n_threads(n_threads),
   _queue_set(queue_set),
-  _offered_termination(0) {}
+  _offered_termination(0),
+  _blocker(NULL),
+  _spin_master(NULL) {
+  if (UseOWSTTaskTerminator && may_block) {
+    _blocker = new Monitor(Mutex::leaf, "ParallelTaskTerminator", false);
+  }
+}
+
+ParallelTaskTerminator::~ParallelTaskTerminator() {
+  if (_blocker != NULL) {
+    delete _blocker;
+  }
+}
+
+ParallelTaskTerminator&
+ParallelTaskTerminator::operator=(const ParallelTaskTerminator& other) {
+  assert(_spin_master == NULL, "Terminator may still be in use");
+  _n_threads = other._n_threads;
+  _queue_set = other._queue_set;
+  _offered_termination = other._offered_termination;
+  return *this;
+}
 
 bool ParallelTaskTerminator::peek_in_queue_set() {
   return _queue_set->peek();
@@ -151,6 +174,9 @@ void ParallelTaskTerminator::sleep(uint millis) {
 
 bool
 ParallelTaskTerminator::offer_termination(TerminatorTerminator* terminator) {
+  if (_blocker != NULL) {
+    return offer_termination_blocking(terminator);
+  }
   assert(_n_threads > 0, "Initialization is incorrect");
   assert(_offered_termination < _n_threads, "Invariant");
   Atomic::inc(&_offered_termination);
@@ -239,6 +265,147 @@ ParallelTaskTerminator::offer_termination(TerminatorTerminator* terminator) {
   }
 }
 
+bool ParallelTaskTerminator::exit_termination(size_t tasks, TerminatorTerminator* terminator) {
+  return tasks > 0 || (terminator != NULL && terminator->should_exit_termination());
+}
+
+bool
+ParallelTaskTerminator::offer_termination_blocking(TerminatorTerminator* terminator) {
+  assert(_n_threads > 0, "Initialization is incorrect");
+  assert(_offered_termination < _n_threads, "Invariant");
+
+  // Single worker, done
+  if (_n_threads == 1) {
+    _offered_termination = 1;
+    return true;
+  }
+
+  _blocker->lock_without_safepoint_check();
+  // All arrived, done
+  _offered_termination++;
+  if (_offered_termination == _n_threads) {
+    _blocker->notify_all();
+    _blocker->unlock();
+    return true;
+  }
+
+  Thread* the_thread = Thread::current();
+  while (true) {
+    if (_spin_master == NULL) {
+      _spin_master = the_thread;
+
+      _blocker->unlock();
+
+      if (do_spin_master_work(terminator)) {
+        assert(_offered_termination == _n_threads, "termination condition");
+        return true;
+      } else {
+        _blocker->lock_without_safepoint_check();
+      }
+    } else {
+      _blocker->wait(true, WorkStealingSleepMillis);
+
+      if (_offered_termination == _n_threads) {
+        _blocker->unlock();
+        return true;
+      }
+    }
+
+    size_t tasks = _queue_set->tasks();
+    if (exit_termination(tasks, terminator)) {
+      _offered_termination--;
+      _blocker->unlock();
+      return false;
+    }
+  }
+}
+
+bool
+ParallelTaskTerminator::do_spin_master_work(TerminatorTerminator* terminator) {
+  uint yield_count = 0;
+  // Number of hard spin loops done since last yield
+  uint hard_spin_count = 0;
+  // Number of iterations in the hard spin loop.
+  uint hard_spin_limit = WorkStealingHardSpins;
+
+  // Same spin/yield schedule as the non-blocking protocol above.
+  if (WorkStealingSpinToYieldRatio > 0) {
+    hard_spin_limit = WorkStealingHardSpins >> WorkStealingSpinToYieldRatio;
+    hard_spin_limit = MAX2(hard_spin_limit, 1U);
+  }
+  // Remember the initial spin limit.
+  uint hard_spin_start = hard_spin_limit;
+
+  // Loop waiting for all threads to offer termination or
+  // more work.
+  while (true) {
+    if (yield_count <= WorkStealingYieldsBeforeSleep) {
+      yield_count++;
+
+      if (hard_spin_count > WorkStealingSpinToYieldRatio) {
+        yield();
+        hard_spin_count = 0;
+        hard_spin_limit = hard_spin_start;
+#ifdef TRACESPINNING
+        _total_yields++;
+#endif
+      } else {
+        hard_spin_limit = MIN2(2*hard_spin_limit,
+                               (uint) WorkStealingHardSpins);
+        for (uint j = 0; j < hard_spin_limit; j++) {
+          SpinPause();
+        }
+        hard_spin_count++;
+#ifdef TRACESPINNING
+        _total_spins++;
+#endif
+      }
+    } else {
+      if (PrintGCDetails && Verbose) {
+        gclog_or_tty->print_cr("ParallelTaskTerminator::do_spin_master_work() "
+          "thread %d sleeps after %d yields",
+          Thread::current(), yield_count);
+      }
+      yield_count = 0;
+
+      // Give up the spin master role while sleeping; a thread woken in
+      // the meantime may take it over, in which case we become a waiter.
+      MonitorLockerEx locker(_blocker, Mutex::_no_safepoint_check_flag);
+      _spin_master = NULL;
+      locker.wait(Mutex::_no_safepoint_check_flag, WorkStealingSleepMillis);
+      if (_spin_master == NULL) {
+        _spin_master = Thread::current();
+      } else {
+        return false;
+      }
+    }
+
+#ifdef TRACESPINNING
+    _total_peeks++;
+#endif
+    size_t tasks = _queue_set->tasks();
+    if (exit_termination(tasks, terminator)) {
+      // Wake up one waiter per task found, beyond the one this thread
+      // will take itself.
+      MonitorLockerEx locker(_blocker, Mutex::_no_safepoint_check_flag);
+      if ((int) tasks >= _offered_termination - 1) {
+        locker.notify_all();
+      } else {
+        for (; tasks > 1; tasks--) {
+          locker.notify();
+        }
+      }
+      _spin_master = NULL;
+      return false;
+    } else if (_offered_termination == _n_threads) {
+      // Everyone else is waiting or leaving; release the role so the
+      // terminator can be reused.
+      _spin_master = NULL;
+      return true;
+    }
+  }
+}
+
 #ifdef TRACESPINNING
 void ParallelTaskTerminator::print_termination_counts() {
   gclog_or_tty->print_cr("ParallelTaskTerminator Total yields: " UINT32_FORMAT
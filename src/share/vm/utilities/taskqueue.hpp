@@ -492,6 +492,8 @@ protected:
 public:
   // Returns "true" if some TaskQueue in the set contains a task.
   virtual bool peek() = 0;
+  // Returns an estimate of the number of tasks in the set.
+  virtual size_t tasks() = 0;
 };
 
 template <MEMFLAGS F> class TaskQueueSetSuperImpl: public CHeapObj<F>, public TaskQueueSetSuper {
@@ -528,6 +530,7 @@ public:
   bool steal(uint queue_num, int* seed, E& t);
 
   bool peek();
+  size_t tasks();
 };
 
 template<class T, MEMFLAGS F> void
@@ -585,6 +588,15 @@ bool GenericTaskQueueSet<T, F>::peek() {
   return false;
 }
 
+template<class T, MEMFLAGS F>
+size_t GenericTaskQueueSet<T, F>::tasks() {
+  size_t n = 0;
+  for (uint j = 0; j < _n; j++) {
+    n += _queues[j]->size();
+  }
+  return n;
+}
+
 // When to terminate from the termination protocol.
 class TerminatorTerminator: public CHeapObj<mtInternal> {
 public:
@@ -600,7 +612,14 @@ class ParallelTaskTerminator: public StackObj {
 private:
   int _n_threads;
   TaskQueueSetSuper* _queue_set;
-  int _offered_termination;
+  volatile int _offered_termination;
+
+  // With UseOWSTTaskTerminator only one offering thread, the spin
+  // master, spins and peeks at the queues; the others wait on _blocker
+  // and are woken in proportion to the number of tasks the spin master
+  // finds.  NULL if the terminator does not block.
+  Monitor* _blocker;
+  Thread* volatile _spin_master;
 
 #ifdef TRACESPINNING
   static uint _total_yields;
@@ -609,6 +628,15 @@ private:
 #endif
 
   bool peek_in_queue_set();
+
+  bool exit_termination(size_t tasks, TerminatorTerminator* terminator);
+  bool offer_termination_blocking(TerminatorTerminator* terminator);
+  // Returns "true" if all threads have offered termination, "false" if
+  // work was found or another thread took over as spin master.
+  bool do_spin_master_work(TerminatorTerminator* terminator);
+
+  // Not copyable; the copy would share _blocker.
+  ParallelTaskTerminator(const ParallelTaskTerminator& other);
 protected:
   virtual void yield();
   void sleep(uint millis);
@@ -616,8 +644,14 @@ protected:
 public:
 
   // "n_threads" is the number of threads to be terminated.  "queue_set" is a
-  // queue sets of work queues of other threads.
-  ParallelTaskTerminator(int n_threads, TaskQueueSetSuper* queue_set);
+  // queue sets of work queues of other threads.  "may_block" is false for
+  // terminators whose yield() must be called by every offering thread.
+  ParallelTaskTerminator(int n_threads, TaskQueueSetSuper* queue_set,
+                         bool may_block = true);
+  ~ParallelTaskTerminator();
+
+  // Copies the termination state but keeps this terminator's _blocker.
+  ParallelTaskTerminator& operator=(const ParallelTaskTerminator& other);
 
   // The current thread has no work, and is ready to terminate if everyone
   // else is.  If returns "true", all threads are terminated.  If returns
@@ -789,6 +823,39 @@ private:
 #pragma warning(pop)
 #endif
 
+// A small FIFO of tasks popped from a task queue.  The owner prefetches
+// the object a task refers to when the task enters the window and
+// processes the task when it leaves, N tasks later, so the cache miss on
+// the object overlaps with the processing of the tasks in front of it.
+// Tasks in the window are invisible to stealing threads; the owner must
+// empty the window before it offers termination.
+template <class E, unsigned int N>
+class TaskPrefetchWindow VALUE_OBJ_CLASS_SPEC {
+  E _elems[N];
+  uint _head;
+  uint _count;
+
+public:
+  TaskPrefetchWindow() : _head(0), _count(0) { }
+
+  bool is_empty() const { return _count == 0; }
+  bool is_full() const  { return _count == N; }
+
+  void push(E t) {
+    assert(!is_full(), "window full");
+    _elems[(_head + _count) % N] = t;
+    _count++;
+  }
+
+  E pop() {
+    assert(!is_empty(), "window empty");
+    E t = _elems[_head];
+    _head = (_head + 1) % N;
+    _count--;
+    return t;
+  }
+};
+
 typedef OverflowTaskQueue<StarTask, mtClass>           OopStarTaskQueue;
 typedef GenericTaskQueueSet<OopStarTaskQueue, mtClass> OopStarTaskQueueSet;
 
@@ -290,10 +290,7 @@ const jbyte* UTF8::strrchr(const jbyte* base, int length, jbyte c) {
 bool UTF8::equal(const jbyte* base1, int length1, const jbyte* base2, int length2) {
   // Length must be the same
   if (length1 != length2) return false;
-  for (int i = 0; i < length1; i++) {
-    if (base1[i] != base2[i]) return false;
-  }
-  return true;
+  return memcmp(base1, base2, length1) == 0;
 }
 
 bool UTF8::is_supplementary_character(const unsigned char* str) {
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test GCPauseBenchmark
+ * @summary Measure GC pause phases over synthetic heap shapes for several collectors and thread counts
+ * @library /testlibrary
+ * @build HeapShapes GCPauseWorkload GCPauseBenchmark
+ * @run main/othervm/timeout=600 GCPauseBenchmark
+ */
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import com.oracle.java.testlibrary.OutputAnalyzer;
+import com.oracle.java.testlibrary.ProcessTools;
+
+/**
+ * Runs GCPauseWorkload in a child VM for every combination of collector,
+ * heap shape, locality and GC thread count, parses the -XX:+PrintGCDetails
+ * output and prints one machine-readable line per phase:
+ *
+ *   gc=<gc> shape=<shape> locality=<l> threads=<n> phase=<name> count=<n> mean_ms=<x> max_ms=<x>
+ *
+ * Running with several thread counts gives the per-phase scaling curves.
+ * Phases are the G1 per-worker and serial phases (G1GCPhaseTimes), timed
+ * sections printed through GCTraceTime, the total pause of each collection
+ * and the total time application threads were stopped.
+ *
+ * The defaults are small enough to run as a regular test.  Properties:
+ *   gc.benchmark.collectors  comma separated, default G1,Parallel,ConcMarkSweep
+ *   gc.benchmark.shapes      comma separated HeapShapes.Shape names, default all
+ *   gc.benchmark.locality    sequential and/or scattered, default scattered
+ *   gc.benchmark.threads     comma separated ParallelGCThreads values, default 2
+ *   gc.benchmark.liveMB      live data built by the shape, default 16
+ *   gc.benchmark.churnMB     garbage allocated while the shape is live, default 64
+ */
+public class GCPauseBenchmark {
+    private static final Pattern G1_WORKER_PHASE =
+        Pattern.compile("\\[([A-Z][A-Za-z ]+) \\(ms\\): +Min: [0-9.]+, Avg: ([0-9.]+)");
+    private static final Pattern G1_SERIAL_PHASE =
+        Pattern.compile("\\[([A-Z][A-Za-z ]+): ([0-9.]+) ms");
+    private static final Pattern TRACE_TIME_PHASE =
+        Pattern.compile("\\[([A-Za-z][A-Za-z ()-]*?) *, ([0-9.]+) secs\\]");
+    private static final Pattern PAUSE =
+        Pattern.compile("^\\[(GC|Full GC).*, ([0-9.]+) secs\\]");
+    private static final Pattern STOPPED =
+        Pattern.compile("Total time for which application threads were stopped: ([0-9.]+) seconds");
+
+    public static void main(String[] args) throws Exception {
+        List<String> collectors = property("gc.benchmark.collectors", "G1,Parallel,ConcMarkSweep");
+        List<String> shapes = property("gc.benchmark.shapes", allShapes());
+        List<String> localities = property("gc.benchmark.locality", "scattered");
+        List<String> threads = property("gc.benchmark.threads", "2");
+        int liveMB = Integer.getInteger("gc.benchmark.liveMB", 16);
+        int churnMB = Integer.getInteger("gc.benchmark.churnMB", 64);
+
+        for (String gc : collectors) {
+            for (String shape : shapes) {
+                for (String locality : localities) {
+                    for (String n : threads) {
+                        run(gc, shape, locality, Integer.parseInt(n), liveMB, churnMB);
+                    }
+                }
+            }
+        }
+    }
+
+    private static void run(String gc, String shape, String locality, int threads,
+                            int liveMB, int churnMB) throws Exception {
+        String heap = (liveMB * 4 + 64) + "m";
+        List<String> vmArgs = new ArrayList<>(Arrays.asList(
+            "-XX:+Use" + gc + "GC",
+            "-XX:ParallelGCThreads=" + threads,
+            "-Xms" + heap, "-Xmx" + heap,
+            "-XX:+PrintGCDetails",
+            "-XX:+PrintGCApplicationStoppedTime"));
+        if (gc.equals("G1")) {
+            // HeapShapes.humongous() assumes 1M regions
+            vmArgs.add("-XX:G1HeapRegionSize=1m");
+        }
+        vmArgs.addAll(Arrays.asList(GCPauseWorkload.class.getName(),
+                                    shape, String.valueOf(liveMB), String.valueOf(churnMB), locality));
+
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(vmArgs.toArray(new String[0]));
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        Map<String, List<Double>> phases = parse(output.getStdout());
+        String prefix = "gc=" + gc + " shape=" + shape + " locality=" + locality + " threads=" + threads;
+        for (Map.Entry<String, List<Double>> e : phases.entrySet()) {
+            List<Double> times = e.getValue();
+            double sum = 0;
+            double max = 0;
+            for (double t : times) {
+                sum += t;
+                max = Math.max(max, t);
+            }
+            System.out.println(String.format("%s phase=%s count=%d mean_ms=%.3f max_ms=%.3f",
+                                             prefix, e.getKey(), times.size(), sum / times.size(), max));
+        }
+    }
+
+    // Returns the times in milliseconds of every phase seen, in order of appearance.
+    private static Map<String, List<Double>> parse(String log) {
+        Map<String, List<Double>> phases = new LinkedHashMap<>();
+        for (String line : log.split("\n")) {
+            String trimmed = line.trim();
+            Matcher m = PAUSE.matcher(trimmed);
+            if (m.find()) {
+                add(phases, m.group(1).equals("GC") ? "Pause" : "Full Pause", Double.parseDouble(m.group(2)) * 1000);
+            }
+            m = STOPPED.matcher(trimmed);
+            if (m.find()) {
+                add(phases, "Stopped", Double.parseDouble(m.group(1)) * 1000);
+                continue;
+            }
+            m = G1_WORKER_PHASE.matcher(trimmed);
+            if (m.find()) {
+                add(phases, m.group(1), Double.parseDouble(m.group(2)));
+                continue;
+            }
+            m = G1_SERIAL_PHASE.matcher(trimmed);
+            if (m.find()) {
+                add(phases, m.group(1), Double.parseDouble(m.group(2)));
+                continue;
+            }
+            m = TRACE_TIME_PHASE.matcher(trimmed);
+            while (m.find()) {
+                String name = m.group(1).trim();
+                if (!name.startsWith("GC") && !name.startsWith("Full GC")) {
+                    add(phases, name, Double.parseDouble(m.group(2)) * 1000);
+                }
+            }
+        }
+        return phases;
+    }
+
+    private static void add(Map<String, List<Double>> phases, String name, double ms) {
+        String key = name.replace(' ', '_');
+        List<Double> times = phases.get(key);
+        if (times == null) {
+            times = new ArrayList<>();
+            phases.put(key, times);
+        }
+        times.add(ms);
+    }
+
+    private static List<String> property(String name, String defaultValue) {
+        return Arrays.asList(System.getProperty(name, defaultValue).split(","));
+    }
+
+    private static String allShapes() {
+        StringBuilder sb = new StringBuilder();
+        for (HeapShapes.Shape s : HeapShapes.Shape.values()) {
+            if (sb.length() > 0) {
+                sb.append(',');
+            }
+            sb.append(s.name());
+        }
+        return sb.toString();
+    }
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * Child process of GCPauseBenchmark.  Builds one heap shape, keeps it live
+ * while allocating garbage to trigger young collections, and finishes with
+ * a System.gc() so full collections are measured as well.
+ *
+ * Usage: GCPauseWorkload <shape> <live MB> <churn MB> <sequential|scattered>
+ */
+public class GCPauseWorkload {
+    public static Object live;
+    public static Object sink;
+
+    public static void main(String[] args) {
+        HeapShapes.Shape shape = HeapShapes.Shape.valueOf(args[0]);
+        long liveBytes = Long.parseLong(args[1]) * 1024 * 1024;
+        long churnBytes = Long.parseLong(args[2]) * 1024 * 1024;
+        boolean scattered = args[3].equals("scattered");
+
+        live = HeapShapes.build(shape, liveBytes, scattered);
+        // Promote the shape before measuring
+        System.gc();
+
+        final int chunk = 1024;
+        for (long allocated = 0; allocated < churnBytes; allocated += chunk) {
+            sink = new byte[chunk];
+            if (shape == HeapShapes.Shape.CARD_DIRTYING && allocated % (256 * 1024) == 0) {
+                HeapShapes.dirtyCards((Object[]) live, 64);
+            }
+        }
+        System.gc();
+    }
+}
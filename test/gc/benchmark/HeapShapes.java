@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+import java.util.Random;
+
+/**
+ * Generators for synthetic heap shapes used by the GC pause benchmarks.
+ * Each generator builds roughly the requested number of live bytes.  With
+ * scattered locality, objects are linked in an order unrelated to their
+ * allocation order, so the collector cannot rely on neighbouring objects
+ * being adjacent in memory.
+ */
+public class HeapShapes {
+    // Approximate size of a Node on a 64-bit VM with compressed oops
+    private static final int NODE_BYTES = 32;
+
+    private static final Random RND = new Random(42);
+
+    public static class Node {
+        Node next;
+        Object ref;
+        long payload;
+    }
+
+    public enum Shape {
+        DEEP_LIST, WIDE_ARRAY, HUMONGOUS, MANY_REFS, CARD_DIRTYING
+    }
+
+    public static Object build(Shape shape, long liveBytes, boolean scattered) {
+        switch (shape) {
+            case DEEP_LIST:     return deepList(liveBytes, scattered);
+            case WIDE_ARRAY:    return wideArray(liveBytes, scattered);
+            case HUMONGOUS:     return humongous(liveBytes);
+            case MANY_REFS:     return manyRefs(liveBytes, scattered);
+            case CARD_DIRTYING: return wideArray(liveBytes, scattered);
+            default:            throw new IllegalArgumentException(shape.toString());
+        }
+    }
+
+    // A single linked list; marking it is inherently sequential.
+    static Node deepList(long liveBytes, boolean scattered) {
+        Node[] nodes = allocateNodes(liveBytes, scattered);
+        for (int i = 0; i < nodes.length - 1; i++) {
+            nodes[i].next = nodes[i + 1];
+        }
+        return nodes[0];
+    }
+
+    // One large array of small objects; scanning it parallelizes well.
+    static Object[] wideArray(long liveBytes, boolean scattered) {
+        Node[] nodes = allocateNodes(liveBytes, scattered);
+        Object[] array = new Object[nodes.length];
+        System.arraycopy(nodes, 0, array, 0, nodes.length);
+        return array;
+    }
+
+    // Arrays larger than half a region, 1M regions assumed for G1.
+    static Object[] humongous(long liveBytes) {
+        final int size = 600 * 1024;
+        Object[] array = new Object[(int) Math.max(1, liveBytes / size)];
+        for (int i = 0; i < array.length; i++) {
+            array[i] = new byte[size];
+        }
+        return array;
+    }
+
+    // Arrays of references into a shared pool of nodes, so most objects
+    // are reached many times.
+    static Object[] manyRefs(long liveBytes, boolean scattered) {
+        final int fanout = 16;
+        Node[] nodes = allocateNodes(liveBytes / 2, scattered);
+        Object[][] holders = new Object[(int) Math.max(1, liveBytes / 2 / (fanout * 4 + 16))][];
+        for (int i = 0; i < holders.length; i++) {
+            Object[] refs = new Object[fanout];
+            for (int j = 0; j < fanout; j++) {
+                int target = scattered ? RND.nextInt(nodes.length)
+                                       : (i * fanout + j) % nodes.length;
+                refs[j] = nodes[target];
+            }
+            holders[i] = refs;
+        }
+        return holders;
+    }
+
+    // Stores fresh objects into random slots of an old array, dirtying cards
+    // all over it between collections.
+    public static void dirtyCards(Object[] old, int stores) {
+        for (int i = 0; i < stores; i++) {
+            old[RND.nextInt(old.length)] = new Node();
+        }
+    }
+
+    private static Node[] allocateNodes(long liveBytes, boolean scattered) {
+        int count = (int) Math.max(2, liveBytes / NODE_BYTES);
+        List<Node> nodes = new ArrayList<>(count);
+        for (int i = 0; i < count; i++) {
+            nodes.add(new Node());
+        }
+        if (scattered) {
+            Collections.shuffle(nodes, RND);
+        }
+        return nodes.toArray(new Node[count]);
+    }
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestMultiANewArrayLeaves
+ * @summary Checks the leaf arrays of multianewarray, both when they are
+ *      allocated as one TLAB batch and when they do not fit in the TLAB.
+ * @run main/othervm -Xmx256m TestMultiANewArrayLeaves
+ * @run main/othervm -Xmx256m -Xint TestMultiANewArrayLeaves
+ * @run main/othervm -Xmx256m -XX:-UseTLAB TestMultiANewArrayLeaves
+ * @run main/othervm -Xmx256m -XX:+UseSerialGC -XX:-ResizeTLAB -XX:TLABSize=8k TestMultiANewArrayLeaves
+ */
+
+import java.util.IdentityHashMap;
+
+public class TestMultiANewArrayLeaves {
+
+    static void check(boolean condition, String message) {
+        if (!condition) {
+            throw new RuntimeException(message);
+        }
+    }
+
+    static void checkLeaves(Object[] outer, int n, int m, Class<?> leafClass) {
+        check(outer.length == n, "outer length " + outer.length + " != " + n);
+        IdentityHashMap<Object, Object> seen = new IdentityHashMap<>();
+        for (int i = 0; i < n; i++) {
+            Object leaf = outer[i];
+            check(leaf != null, "leaf " + i + " is null");
+            check(leaf.getClass() == leafClass, "leaf " + i + " has class " + leaf.getClass());
+            check(java.lang.reflect.Array.getLength(leaf) == m,
+                  "leaf " + i + " has length " + java.lang.reflect.Array.getLength(leaf));
+            check(seen.put(leaf, leaf) == null, "leaf " + i + " is shared");
+        }
+    }
+
+    static void testInt(int n, int m) {
+        int[][] a = new int[n][m];
+        checkLeaves(a, n, m, int[].class);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < m; j++) {
+                check(a[i][j] == 0, "int[" + i + "][" + j + "] not zero");
+            }
+        }
+        // Writing one leaf must not show through in its neighbours.
+        for (int i = 0; i < n; i++) {
+            if (m > 0) {
+                a[i][0] = i + 1;
+                a[i][m - 1] = -(i + 1);
+            }
+        }
+        for (int i = 0; i < n; i++) {
+            if (m > 0) {
+                check(a[i][0] == (m == 1 ? -(i + 1) : i + 1), "int[" + i + "][0] overwritten");
+                check(a[i][m - 1] == -(i + 1), "int[" + i + "][" + (m - 1) + "] overwritten");
+            }
+        }
+    }
+
+    static void testByte(int n, int m) {
+        byte[][] a = new byte[n][m];
+        checkLeaves(a, n, m, byte[].class);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < m; j++) {
+                check(a[i][j] == 0, "byte[" + i + "][" + j + "] not zero");
+            }
+        }
+    }
+
+    static void testLong(int n, int m) {
+        long[][] a = new long[n][m];
+        checkLeaves(a, n, m, long[].class);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < m; j++) {
+                check(a[i][j] == 0L, "long[" + i + "][" + j + "] not zero");
+            }
+        }
+    }
+
+    static void testObject(int n, int m, boolean gc) {
+        String[][] a = new String[n][m];
+        checkLeaves(a, n, m, String[].class);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < m; j++) {
+                check(a[i][j] == null, "String[" + i + "][" + j + "] not null");
+            }
+            if (m > 0) {
+                a[i][m - 1] = "s" + i;
+            }
+        }
+        // Force the leaves through a GC and check they survived intact.
+        if (gc) {
+            System.gc();
+        }
+        for (int i = 0; i < n; i++) {
+            if (m > 0) {
+                check(("s" + i).equals(a[i][m - 1]), "String[" + i + "] lost its element");
+            }
+        }
+    }
+
+    static void testRank3(int n, int m, int k) {
+        int[][][] a = new int[n][m][k];
+        check(a.length == n, "rank 3 outer length");
+        for (int i = 0; i < n; i++) {
+            checkLeaves(a[i], m, k, int[].class);
+        }
+    }
+
+    static void testNegative(int n, int m) {
+        try {
+            int[][] a = new int[n][m];
+            throw new RuntimeException("expected NegativeArraySizeException for " + n + ", " + m);
+        } catch (NegativeArraySizeException e) {
+            // expected
+        }
+    }
+
+    public static void main(String[] args) {
+        // Small shapes fit in a TLAB and take the batch path; large ones
+        // exceed it and fall back to allocating the leaves one by one.
+        int[][] shapes = {
+            { 1, 0 }, { 1, 1 }, { 2, 3 }, { 10, 10 }, { 100, 7 },
+            { 1000, 1 }, { 64, 1024 }, { 16, 100000 }, { 4, 1000000 },
+        };
+        for (int iter = 0; iter < 2000; iter++) {
+            for (int[] shape : shapes) {
+                int n = shape[0];
+                int m = shape[1];
+                if (iter % 100 != 0 && (long) n * m > 100000) {
+                    continue;
+                }
+                testInt(n, m);
+                testByte(n, m);
+                testLong(n, m);
+                testObject(n, m > 10000 ? 10000 : m, iter % 100 == 0);
+            }
+            testRank3(3, 5, 7);
+            testNegative(3, -1);
+            testNegative(0, -1);
+        }
+    }
+}
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestFutexPark
+ * @summary Exercises park/unpark, timed parks, interrupts and monitor
+ *      wakeups with the futex-based PlatformEvent and Parker.
+ * @library /testlibrary
+ * @run main/timeout=300 TestFutexPark
+ */
+
+import com.oracle.java.testlibrary.OutputAnalyzer;
+import com.oracle.java.testlibrary.Platform;
+import com.oracle.java.testlibrary.ProcessTools;
+import java.util.concurrent.locks.LockSupport;
+
+public class TestFutexPark {
+
+    public static void main(String[] args) throws Exception {
+        if (!Platform.isLinux()) {
+            System.out.println("Skipping. UseFutexPark is only implemented on Linux.");
+            return;
+        }
+        // With the default spin limit and with parks that always block in
+        // the kernel.
+        run("-XX:+UseFutexPark");
+        run("-XX:+UseFutexPark", "-XX:FutexParkSpinLimit=0");
+    }
+
+    static void run(String... flags) throws Exception {
+        String[] command = new String[flags.length + 3];
+        System.arraycopy(flags, 0, command, 0, flags.length);
+        command[flags.length] = "-cp";
+        command[flags.length + 1] = System.getProperty("java.class.path");
+        command[flags.length + 2] = Workload.class.getName();
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(command);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        System.out.println(output.getOutput());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("PASSED");
+    }
+
+    public static class Workload {
+
+        static void check(boolean condition, String message) {
+            if (!condition) {
+                throw new RuntimeException(message);
+            }
+        }
+
+        static void join(Thread t) throws InterruptedException {
+            t.join(60000);
+            check(!t.isAlive(), t.getName() + " did not finish");
+        }
+
+        static volatile int turn;
+
+        // Two threads hand a token back and forth with park/unpark.
+        static void testHandoff() throws Exception {
+            final int rounds = 20000;
+            final Thread[] threads = new Thread[2];
+            turn = 0;
+            for (int i = 0; i < 2; i++) {
+                final int me = i;
+                threads[i] = new Thread("Handoff-" + i) {
+                    public void run() {
+                        for (int r = 0; r < rounds; r++) {
+                            while (turn != me) {
+                                LockSupport.park(this);
+                            }
+                            turn = 1 - me;
+                            LockSupport.unpark(threads[1 - me]);
+                        }
+                    }
+                };
+            }
+            threads[0].start();
+            threads[1].start();
+            join(threads[0]);
+            join(threads[1]);
+
+            // A permit given before park makes park return at once.
+            LockSupport.unpark(Thread.currentThread());
+            long start = System.nanoTime();
+            LockSupport.park();
+            check(System.nanoTime() - start < 5000L * 1000 * 1000, "park ignored the permit");
+        }
+
+        // Timed parks must time out, and must not return over and over
+        // before their deadline.
+        static void testTimed() throws Exception {
+            long start = System.nanoTime();
+            LockSupport.parkNanos(50L * 1000 * 1000);
+            check(System.nanoTime() - start < 30000L * 1000 * 1000, "parkNanos did not time out");
+
+            start = System.currentTimeMillis();
+            LockSupport.parkUntil(start + 50);
+            check(System.currentTimeMillis() - start < 30000, "parkUntil did not time out");
+
+            // Deadlines in the past return at once.
+            LockSupport.parkUntil(0);
+            LockSupport.parkUntil(System.currentTimeMillis() - 1000);
+            LockSupport.parkNanos(0);
+            LockSupport.parkNanos(-1);
+
+            for (final boolean absolute : new boolean[] { false, true }) {
+                final int[] returns = new int[1];
+                final boolean[] done = new boolean[1];
+                Thread t = new Thread("FarDeadline") {
+                    public void run() {
+                        while (!isDone()) {
+                            if (absolute) {
+                                LockSupport.parkUntil(Long.MAX_VALUE);
+                            } else {
+                                LockSupport.parkNanos(Long.MAX_VALUE);
+                            }
+                            synchronized (returns) {
+                                returns[0]++;
+                            }
+                        }
+                    }
+                    boolean isDone() {
+                        synchronized (done) {
+                            return done[0];
+                        }
+                    }
+                };
+                t.start();
+                Thread.sleep(1000);
+                int early;
+                synchronized (returns) {
+                    early = returns[0];
+                }
+                synchronized (done) {
+                    done[0] = true;
+                }
+                LockSupport.unpark(t);
+                join(t);
+                // A few spurious returns are allowed, a spinning loop is not.
+                check(early < 100, (absolute ? "parkUntil" : "parkNanos") +
+                      "(Long.MAX_VALUE) returned " + early + " times");
+            }
+        }
+
+        // Interrupts wake parked, sleeping and waiting threads.
+        static void testInterrupt() throws Exception {
+            final boolean[] result = new boolean[4];
+            Thread[] threads = new Thread[] {
+                new Thread("ParkInterrupt") {
+                    public void run() {
+                        while (!isInterrupted()) {
+                            LockSupport.park();
+                        }
+                        result[0] = true;
+                    }
+                },
+                new Thread("ParkNanosInterrupt") {
+                    public void run() {
+                        while (!isInterrupted()) {
+                            LockSupport.parkNanos(Long.MAX_VALUE);
+                        }
+                        result[1] = true;
+                    }
+                },
+                new Thread("SleepInterrupt") {
+                    public void run() {
+                        try {
+                            Thread.sleep(Long.MAX_VALUE);
+                        } catch (InterruptedException e) {
+                            result[2] = true;
+                        }
+                    }
+                },
+                new Thread("WaitInterrupt") {
+                    public void run() {
+                        Object o = new Object();
+                        synchronized (o) {
+                            try {
+                                o.wait();
+                            } catch (InterruptedException e) {
+                                result[3] = true;
+                            }
+                        }
+                    }
+                },
+            };
+            for (Thread t : threads) {
+                t.start();
+            }
+            Thread.sleep(500);
+            for (Thread t : threads) {
+                t.interrupt();
+            }
+            for (int i = 0; i < threads.length; i++) {
+                join(threads[i]);
+                check(result[i], threads[i].getName() + " was not woken by interrupt");
+            }
+
+            // An interrupt before park makes park return at once.
+            Thread.currentThread().interrupt();
+            LockSupport.park();
+            check(Thread.interrupted(), "interrupt status lost");
+        }
+
+        static final Object lock = new Object();
+        static long counter;
+
+        // Contended monitor enters and wait/notify handoffs.
+        static void testSynchronized() throws Exception {
+            final int nthreads = 8;
+            final int increments = 20000;
+            counter = 0;
+            Thread[] threads = new Thread[nthreads];
+            for (int i = 0; i < nthreads; i++) {
+                threads[i] = new Thread("Contender-" + i) {
+                    public void run() {
+                        for (int j = 0; j < increments; j++) {
+                            synchronized (lock) {
+                                counter++;
+                                if ((j & 0xff) == 0) {
+                                    lock.notifyAll();
+                                    try {
+                                        lock.wait(1);
+                                    } catch (InterruptedException e) {
+                                        throw new RuntimeException(e);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                };
+            }
+            for (Thread t : threads) {
+                t.start();
+            }
+            for (Thread t : threads) {
+                join(t);
+            }
+            check(counter == (long) nthreads * increments, "lost updates: " + counter);
+        }
+
+        public static void main(String[] args) throws Exception {
+            testHandoff();
+            testTimed();
+            testInterrupt();
+            testSynchronized();
+            System.out.println("PASSED");
+        }
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Contends on a lock from several threads and checks that
+ *      Thread.monitor_contention reports the monitor and its owner.
+ * @key jcmd
+ * @library /testlibrary
+ * @run main/othervm -XX:-UseBiasedLocking TestMonitorContentionDCmd
+ */
+
+import com.oracle.java.testlibrary.*;
+
+public class TestMonitorContentionDCmd {
+
+    static class HotLock { }
+
+    static final HotLock lock = new HotLock();
+    static volatile boolean done = false;
+    static long counter = 0;
+
+    public static void main(String args[]) throws Exception {
+        Thread[] workers = new Thread[4];
+        for (int i = 0; i < workers.length; i++) {
+            workers[i] = new Thread("Contender-" + i) {
+                public void run() {
+                    while (!done) {
+                        synchronized (lock) {
+                            counter++;
+                            try {
+                                Thread.sleep(1);
+                            } catch (InterruptedException e) {
+                            }
+                        }
+                    }
+                }
+            };
+            workers[i].start();
+        }
+        Thread.sleep(1000);
+
+        OutputAnalyzer output;
+        synchronized (lock) {
+            // Hold the monitor so that it stays inflated and has an owner.
+            String pid = Integer.toString(ProcessTools.getProcessId());
+            ProcessBuilder pb = new ProcessBuilder();
+            pb.command(new String[] { JDKToolFinder.getJDKTool("jcmd"), pid, "Thread.monitor_contention", "-top=5"});
+            output = new OutputAnalyzer(pb.start());
+            done = true;
+        }
+        for (Thread t : workers) {
+            t.join();
+        }
+
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Contended monitors:");
+        output.shouldContain("(a TestMonitorContentionDCmd$HotLock)");
+        output.shouldContain("owner: \"main\"");
+        output.shouldContain("contended enters:");
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestThreadStackPool
+ * @summary Creates and exits many threads with UseThreadStackPool and checks
+ *      that the reused stacks still handle deep recursion and overflow.
+ * @library /testlibrary
+ * @run main/timeout=300 TestThreadStackPool
+ */
+
+import com.oracle.java.testlibrary.OutputAnalyzer;
+import com.oracle.java.testlibrary.Platform;
+import com.oracle.java.testlibrary.ProcessTools;
+
+public class TestThreadStackPool {
+
+    public static void main(String[] args) throws Exception {
+        if (!Platform.isLinux()) {
+            System.out.println("Skipping. UseThreadStackPool is only implemented on Linux.");
+            return;
+        }
+        // A small pool is trimmed often; a pool of one is nearly always full.
+        run("-XX:+UseThreadStackPool", "-XX:ThreadStackPoolSize=4");
+        run("-XX:+UseThreadStackPool", "-XX:ThreadStackPoolSize=1", "-Xss512k");
+    }
+
+    static void run(String... flags) throws Exception {
+        String[] command = new String[flags.length + 3];
+        System.arraycopy(flags, 0, command, 0, flags.length);
+        command[flags.length] = "-cp";
+        command[flags.length + 1] = System.getProperty("java.class.path");
+        command[flags.length + 2] = Workload.class.getName();
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(command);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        System.out.println(output.getOutput());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("PASSED");
+    }
+
+    public static class Workload {
+
+        static int depth;
+
+        static void recurse() {
+            depth++;
+            recurse();
+        }
+
+        // Recurses until StackOverflowError and returns the depth reached.
+        static int overflow() {
+            depth = 0;
+            try {
+                recurse();
+            } catch (StackOverflowError e) {
+                return depth;
+            }
+            throw new RuntimeException("no StackOverflowError");
+        }
+
+        static class Worker extends Thread {
+            final boolean overflow;
+            volatile int result = -1;
+            volatile Throwable failure;
+
+            Worker(int id, boolean overflow) {
+                super("Worker-" + id);
+                this.overflow = overflow;
+            }
+
+            public void run() {
+                try {
+                    if (overflow) {
+                        // Overflow twice: the guard pages must have been
+                        // re-enabled after the first overflow.
+                        int first = overflow();
+                        int second = overflow();
+                        result = Math.min(first, second);
+                    } else {
+                        result = 0;
+                    }
+                } catch (Throwable t) {
+                    failure = t;
+                }
+            }
+        }
+
+        public static void main(String[] args) throws Exception {
+            final int rounds = 200;
+            final int batch = 16;
+            int minDepth = Integer.MAX_VALUE;
+            for (int r = 0; r < rounds; r++) {
+                // Bursts of exits followed by bursts of creations, so that
+                // new threads pick up stacks of threads that just exited.
+                Worker[] workers = new Worker[batch];
+                for (int i = 0; i < batch; i++) {
+                    workers[i] = new Worker(r * batch + i, i % 4 == 0);
+                    workers[i].start();
+                }
+                for (Worker w : workers) {
+                    w.join(60000);
+                    if (w.isAlive()) {
+                        throw new RuntimeException(w.getName() + " did not finish");
+                    }
+                    if (w.failure != null) {
+                        throw new RuntimeException(w.getName() + " failed", w.failure);
+                    }
+                    if (w.result < 0) {
+                        throw new RuntimeException(w.getName() + " did not run");
+                    }
+                    if (w.overflow) {
+                        minDepth = Math.min(minDepth, w.result);
+                    }
+                }
+            }
+            // Every overflow must have been caught well below the stack
+            // size, not at some shallow depth on a broken stack.
+            if (minDepth < 100) {
+                throw new RuntimeException("StackOverflowError at depth " + minDepth);
+            }
+            System.out.println("minimum overflow depth: " + minDepth);
+            System.out.println("PASSED");
+        }
+    }
+}
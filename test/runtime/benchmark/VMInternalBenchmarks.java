@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2016, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test VMInternalBenchmarks
+ * @summary Micro benchmarks of VM-internal hot paths driven through WhiteBox
+ * @library /testlibrary /testlibrary/whitebox
+ * @build VMInternalBenchmarks
+ * @run main ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI VMInternalBenchmarks
+ */
+
+import java.util.Arrays;
+
+import sun.hotspot.WhiteBox;
+
+/**
+ * Runs each benchmark for a number of warmup rounds, then for a number of
+ * measured rounds, and prints one machine-readable line per benchmark:
+ *
+ *   benchmark=<name> rounds=<n> ops=<n> mean_ns=<x> stddev_ns=<x> min_ns=<x> max_ns=<x>
+ *
+ * All times are per operation.  The defaults are kept small so the test is
+ * cheap when run as part of a regular test run; use the properties
+ * benchmark.warmup, benchmark.rounds and benchmark.iterations to get
+ * stable numbers.
+ */
+public class VMInternalBenchmarks {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    private static final int WARMUP = Integer.getInteger("benchmark.warmup", 3);
+    private static final int ROUNDS = Integer.getInteger("benchmark.rounds", 5);
+    private static final int ITERATIONS = Integer.getInteger("benchmark.iterations", 1000);
+
+    private interface Benchmark {
+        // Returns the elapsed time in nanoseconds for the given number of operations
+        long run(int iterations);
+    }
+
+    public static void main(String[] args) {
+        run("symbol_lookup", ITERATIONS, new Benchmark() {
+            public long run(int n) { return WB.benchmarkSymbolLookup("java/lang/Object", n); }
+        });
+        run("monitor_inflation", ITERATIONS, new Benchmark() {
+            public long run(int n) { return WB.benchmarkMonitorInflation(n); }
+        });
+        run("tlab_allocation", ITERATIONS, new Benchmark() {
+            public long run(int n) { return WB.benchmarkTLABAllocation(64, n); }
+        });
+        // Safepoints are orders of magnitude more expensive than the rest
+        run("safepoint", Math.max(1, ITERATIONS / 100), new Benchmark() {
+            public long run(int n) { return WB.benchmarkSafepoint(n); }
+        });
+        run("code_cache_allocation", ITERATIONS, new Benchmark() {
+            public long run(int n) { return WB.benchmarkCodeCacheAllocation(1024, n); }
+        });
+    }
+
+    private static void run(String name, int iterations, Benchmark b) {
+        for (int i = 0; i < WARMUP; i++) {
+            check(name, b.run(iterations));
+        }
+        double[] perOp = new double[ROUNDS];
+        for (int i = 0; i < ROUNDS; i++) {
+            perOp[i] = (double) check(name, b.run(iterations)) / iterations;
+        }
+        report(name, iterations, perOp);
+    }
+
+    private static long check(String name, long elapsed) {
+        if (elapsed < 0) {
+            throw new RuntimeException(name + " failed: " + elapsed);
+        }
+        return elapsed;
+    }
+
+    private static void report(String name, int iterations, double[] perOp) {
+        double sum = 0;
+        for (double t : perOp) {
+            sum += t;
+        }
+        double mean = sum / perOp.length;
+        double var = 0;
+        for (double t : perOp) {
+            var += (t - mean) * (t - mean);
+        }
+        double stddev = perOp.length > 1 ? Math.sqrt(var / (perOp.length - 1)) : 0;
+        double[] sorted = perOp.clone();
+        Arrays.sort(sorted);
+        System.out.println(String.format("benchmark=%s rounds=%d ops=%d mean_ns=%.1f stddev_ns=%.1f min_ns=%.1f max_ns=%.1f",
+                                         name, perOp.length, iterations, mean, stddev,
+                                         sorted[0], sorted[sorted.length - 1]));
+    }
+}
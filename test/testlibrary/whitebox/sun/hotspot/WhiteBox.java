@@ -91,6 +91,14 @@ public class WhiteBox {
   public native boolean isMonitorInflated(Object obj);
   public native void forceSafepoint();
 
+  // VM-internal micro benchmarks, each returning the elapsed time in
+  // nanoseconds for the given number of iterations
+  public native long benchmarkSymbolLookup(String name, int iterations);
+  public native long benchmarkMonitorInflation(int iterations);
+  public native long benchmarkTLABAllocation(int length, int iterations);
+  public native long benchmarkSafepoint(int iterations);
+  public native long benchmarkCodeCacheAllocation(int size, int iterations);
+
   // Resource/Class Lookup Cache
   public native boolean classKnownToNotExist(ClassLoader loader, String name);
   public native URL[] getLookupCacheURLs(ClassLoader loader);